@@ -0,0 +1,201 @@
+//-------------------------------------------------------------------
+/**
+ * @file BalancingBenchmark.cpp
+ * @brief Benchmark of the balancing modes of the binary search tree under skewed searches
+ * @details Builds the same binary search tree without balancing, as a red-black tree, as a splay tree and as a
+ * scapegoat tree, then searches uniformly random data and Zipf distributed data whose most frequent data are
+ * spread randomly over the tree. Reports the time per insertion and per search along with the height after the searches. Run it
+ * with `make benchmark`.
+ * @author Aditya Jedhe
+ * @date 2025-03-17
+ */
+//-------------------------------------------------------------------
+
+// ---------------------------------------------- Local Headers
+#include "BinaryTree.h"
+
+// ---------------------------------------------- System Headers
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Main function running the benchmark
+ */
+int main();
+
+/**
+ * @brief Draws data from the given data with a Zipf distribution
+ * @param[in] ivData Data to draw from, the first one being the most frequent
+ * @param[in] idExponent Exponent of the distribution, the larger the more skewed
+ * @param[in] inCount Number of data to draw
+ * @param[in, out] ioRandom Random number generator
+ * @return Drawn data
+ */
+std::vector<int> RetrieveZipfData(const std::vector<int> &ivData,
+                                  double idExponent,
+                                  int inCount,
+                                  std::mt19937 &ioRandom);
+
+/**
+ * @brief Measures the searches of the given data
+ * @param[in] ipBinaryTree Binary search tree to search in
+ * @param[in] ivData Data to search for
+ * @param[out] onFound Number of data found
+ * @return Nanoseconds per search
+ */
+double MeasureSearches(BinaryTree *ipBinaryTree,
+                       const std::vector<int> &ivData,
+                       int &onFound);
+
+//-------------------------------------------------------------------
+int main()
+{
+    const int nNodes = 1 << 20;
+    const int nSearches = 1 << 22;
+
+    std::mt19937 objRandom(2025);
+
+    /**
+     * Distinct data inserted in random order, spread wider than the
+     * dense key bitmap covers so that the searches descend
+     */
+    std::vector<int> vData(nNodes);
+
+    std::iota(vData.begin(), vData.end(), 0);
+    std::transform(vData.begin(), vData.end(), vData.begin(), [](int inData)
+                   { return 128 * inData; });
+    std::shuffle(vData.begin(), vData.end(), objRandom);
+
+    /**
+     * Half of the uniform data is absent from the tree. The Zipf data
+     * ranks the data in an order independent of the insertion order,
+     * so the frequent data are neither all near the root node of the
+     * unbalanced tree nor all in one sub-binary tree.
+     */
+    std::uniform_int_distribution<int> objUniform(0, 2 * nNodes - 1);
+
+    std::vector<int> vUniformData(nSearches);
+
+    for (auto &nData : vUniformData)
+    {
+        nData = 64 * objUniform(objRandom);
+    }
+
+    std::vector<std::pair<std::string, std::vector<int>>> vCases;
+
+    std::vector<int> vRankedData(vData);
+
+    std::shuffle(vRankedData.begin(), vRankedData.end(), objRandom);
+
+    vCases.emplace_back("uniform", std::move(vUniformData));
+    vCases.emplace_back("zipf 0.99", RetrieveZipfData(vRankedData, 0.99, nSearches, objRandom));
+    vCases.emplace_back("zipf 1.2", RetrieveZipfData(vRankedData, 1.2, nSearches, objRandom));
+
+    std::cout << std::setw(12) << "Mode"
+              << std::setw(12) << "Data"
+              << std::setw(14) << "Insert ns"
+              << std::setw(14) << "Search ns"
+              << std::setw(10) << "Height"
+              << std::setw(10) << "Found" << std::endl;
+
+    for (const auto &objMode : {std::make_pair("none", BinaryTree::BALANCING_NONE),
+                                std::make_pair("red-black", BinaryTree::BALANCING_RED_BLACK),
+                                std::make_pair("splay", BinaryTree::BALANCING_SPLAY),
+                                std::make_pair("scapegoat", BinaryTree::BALANCING_SCAPEGOAT)})
+    {
+        for (const auto &objCase : vCases)
+        {
+            /**
+             * A fresh tree per case, so a splay tree does not start from
+             * the shape left by the previous searches
+             */
+            BinaryTree *pBinaryTree = BinaryTree::CreateBinaryTree();
+
+            pBinaryTree->SetBalancingMode(objMode.second);
+
+            auto objStart = std::chrono::steady_clock::now();
+
+            for (auto nData : vData)
+            {
+                pBinaryTree->InsertNodeInBinarySearchTree(nData);
+            }
+
+            auto objEnd = std::chrono::steady_clock::now();
+
+            double dInsert = std::chrono::duration<double, std::nano>(objEnd - objStart).count() / nNodes;
+
+            int nFound(0);
+
+            double dSearch = MeasureSearches(pBinaryTree, objCase.second, nFound);
+
+            std::cout << std::setw(12) << objMode.first
+                      << std::setw(12) << objCase.first
+                      << std::setw(14) << std::fixed << std::setprecision(1) << dInsert
+                      << std::setw(14) << dSearch
+                      << std::setw(10) << pBinaryTree->HeightOfBinaryTree()
+                      << std::setw(10) << nFound << std::endl;
+
+            BinaryTree::RemoveBinaryTree(pBinaryTree);
+        }
+    }
+
+    return 0;
+}
+
+//-------------------------------------------------------------------
+std::vector<int> RetrieveZipfData(const std::vector<int> &ivData,
+                                  double idExponent,
+                                  int inCount,
+                                  std::mt19937 &ioRandom)
+{
+    const int nSize = (int)(ivData.size());
+
+    std::vector<double> vCumulative(nSize);
+
+    double dSum(0.0);
+
+    for (int nIdx = 0; nIdx < nSize; ++nIdx)
+    {
+        dSum += 1.0 / std::pow(nIdx + 1, idExponent);
+        vCumulative[nIdx] = dSum;
+    }
+
+    std::uniform_real_distribution<double> objUniform(0.0, dSum);
+
+    std::vector<int> vData(inCount);
+
+    for (auto &nData : vData)
+    {
+        auto itRank = std::lower_bound(vCumulative.begin(), vCumulative.end(), objUniform(ioRandom));
+
+        nData = ivData[std::min<int>((int)(itRank - vCumulative.begin()), nSize - 1)];
+    }
+
+    return vData;
+}
+
+//-------------------------------------------------------------------
+double MeasureSearches(BinaryTree *ipBinaryTree,
+                       const std::vector<int> &ivData,
+                       int &onFound)
+{
+    onFound = 0;
+
+    auto objStart = std::chrono::steady_clock::now();
+
+    for (auto nData : ivData)
+    {
+        onFound += ipBinaryTree->SearchInBinaryTree(nData);
+    }
+
+    auto objEnd = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(objEnd - objStart).count() / ivData.size();
+}
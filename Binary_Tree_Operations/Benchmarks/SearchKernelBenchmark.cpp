@@ -0,0 +1,259 @@
+//-------------------------------------------------------------------
+/**
+ * @file SearchKernelBenchmark.cpp
+ * @brief Microbenchmark of the search kernels of the binary search tree
+ * @details Compares the branchy and the branchless descent, the radix index, the search of an Eytzinger
+ * snapshot and of a van Emde Boas snapshot, and the search of a B+ tree holding the same data, on random binary
+ * search trees of several sizes, searching uniformly random data and Zipf distributed data. Run it with
+ * `make benchmark`.
+ * @author Aditya Jedhe
+ * @date 2025-03-10
+ */
+//-------------------------------------------------------------------
+
+// ---------------------------------------------- Local Headers
+#include "BPlusTree.h"
+#include "BinaryTree.h"
+#include "EytzingerSnapshot.h"
+#include "VanEmdeBoasSnapshot.h"
+
+// ---------------------------------------------- System Headers
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Main function running the benchmark
+ */
+int main();
+
+/**
+ * @brief Draws data from the given data with a Zipf distribution
+ * @param[in] ivData Data to draw from, the first one being the most frequent
+ * @param[in] inCount Number of data to draw
+ * @param[in, out] ioRandom Random number generator
+ * @return Drawn data
+ */
+std::vector<int> RetrieveZipfData(const std::vector<int> &ivData,
+                                  int inCount,
+                                  std::mt19937 &ioRandom);
+
+/**
+ * @brief Measures the searches of the given data
+ * @param[in] ipBinaryTree Binary search tree to search in
+ * @param[in] ivData Data to search for
+ * @param[in] ibBranchless True for the branchless kernel, false for the branchy kernel
+ * @param[in] ibRadixIndex True for searching the radix index instead of descending the binary search tree
+ * @param[out] onFound Number of data found
+ * @return Nanoseconds per search
+ */
+double MeasureSearches(BinaryTree *ipBinaryTree,
+                       const std::vector<int> &ivData,
+                       bool ibBranchless,
+                       bool ibRadixIndex,
+                       int &onFound);
+
+/**
+ * @brief Measures the searches of the given data in a snapshot
+ * @tparam Snapshot EytzingerSnapshot, VanEmdeBoasSnapshot or BPlusTree
+ * @param[in] iobjSnapshot Snapshot to search in
+ * @param[in] ivData Data to search for
+ * @param[out] onFound Number of data found
+ * @return Nanoseconds per search
+ */
+template <typename Snapshot>
+double MeasureSnapshotSearches(Snapshot &iobjSnapshot,
+                               const std::vector<int> &ivData,
+                               int &onFound);
+
+//-------------------------------------------------------------------
+int main()
+{
+    const int nSearches = 1 << 21;
+
+    std::mt19937 objRandom(2025);
+
+    std::cout << std::setw(10) << "Nodes"
+              << std::setw(10) << "Data"
+              << std::setw(14) << "Branchy ns"
+              << std::setw(16) << "Branchless ns"
+              << std::setw(10) << "ART ns"
+              << std::setw(16) << "Eytzinger ns"
+              << std::setw(10) << "vEB ns"
+              << std::setw(10) << "B+ ns"
+              << std::setw(10) << "Found" << std::endl;
+
+    for (int nNodes : {1 << 10, 1 << 16, 1 << 20})
+    {
+        /**
+         * Distinct data inserted in random order, spread wider than
+         * the dense key bitmap covers so that the searches descend
+         */
+        std::vector<int> vData(nNodes);
+
+        std::iota(vData.begin(), vData.end(), 0);
+        std::transform(vData.begin(), vData.end(), vData.begin(), [](int inData)
+                       { return 128 * inData; });
+        std::shuffle(vData.begin(), vData.end(), objRandom);
+
+        BinaryTree *pBinaryTree = BinaryTree::CreateBinaryTree();
+        BPlusTree *pBPlusTree = BPlusTree::CreateBPlusTree();
+
+        for (auto nData : vData)
+        {
+            pBinaryTree->InsertNodeInBinarySearchTree(nData);
+            pBPlusTree->InsertNodeInBinarySearchTree(nData);
+        }
+
+        EytzingerSnapshot objSnapshot(pBinaryTree);
+        VanEmdeBoasSnapshot objVanEmdeBoasSnapshot(pBinaryTree);
+
+        /**
+         * Half of the uniform data is absent from the tree
+         */
+        std::uniform_int_distribution<int> objUniform(0, 2 * nNodes - 1);
+
+        std::vector<int> vUniformData(nSearches);
+
+        for (auto &nData : vUniformData)
+        {
+            nData = 64 * objUniform(objRandom);
+        }
+
+        std::vector<int> vZipfData = RetrieveZipfData(vData, nSearches, objRandom);
+
+        for (const auto &objCase : {std::make_pair("uniform", &vUniformData),
+                                    std::make_pair("zipf", &vZipfData)})
+        {
+            int nBranchyFound(0);
+            int nBranchlessFound(0);
+            int nRadixIndexFound(0);
+            int nSnapshotFound(0);
+            int nVanEmdeBoasFound(0);
+            int nBPlusTreeFound(0);
+
+            double dBranchy = MeasureSearches(pBinaryTree, *objCase.second, false, false, nBranchyFound);
+            double dBranchless = MeasureSearches(pBinaryTree, *objCase.second, true, false, nBranchlessFound);
+            double dRadixIndex = MeasureSearches(pBinaryTree, *objCase.second, false, true, nRadixIndexFound);
+            double dSnapshot = MeasureSnapshotSearches(objSnapshot, *objCase.second, nSnapshotFound);
+            double dVanEmdeBoas = MeasureSnapshotSearches(objVanEmdeBoasSnapshot, *objCase.second, nVanEmdeBoasFound);
+            double dBPlusTree = MeasureSnapshotSearches(*pBPlusTree, *objCase.second, nBPlusTreeFound);
+
+            if ((nBranchyFound != nBranchlessFound) || (nBranchyFound != nRadixIndexFound) ||
+                (nBranchyFound != nSnapshotFound) ||
+                (nBranchyFound != nVanEmdeBoasFound) || (nBranchyFound != nBPlusTreeFound))
+            {
+                std::cout << "ERR<<Kernels found a different number of data.>>" << std::endl;
+            }
+
+            std::cout << std::setw(10) << nNodes
+                      << std::setw(10) << objCase.first
+                      << std::setw(14) << std::fixed << std::setprecision(1) << dBranchy
+                      << std::setw(16) << dBranchless
+                      << std::setw(10) << dRadixIndex
+                      << std::setw(16) << dSnapshot
+                      << std::setw(10) << dVanEmdeBoas
+                      << std::setw(10) << dBPlusTree
+                      << std::setw(10) << nBranchlessFound << std::endl;
+        }
+
+        BinaryTree::RemoveBinaryTree(pBinaryTree);
+        BPlusTree::RemoveBPlusTree(pBPlusTree);
+    }
+
+    return 0;
+}
+
+//-------------------------------------------------------------------
+std::vector<int> RetrieveZipfData(const std::vector<int> &ivData,
+                                  int inCount,
+                                  std::mt19937 &ioRandom)
+{
+    const int nSize = (int)(ivData.size());
+
+    std::vector<double> vCumulative(nSize);
+
+    double dSum(0.0);
+
+    for (int nIdx = 0; nIdx < nSize; ++nIdx)
+    {
+        dSum += 1.0 / (nIdx + 1);
+        vCumulative[nIdx] = dSum;
+    }
+
+    std::uniform_real_distribution<double> objUniform(0.0, dSum);
+
+    std::vector<int> vData(inCount);
+
+    for (auto &nData : vData)
+    {
+        auto itRank = std::lower_bound(vCumulative.begin(), vCumulative.end(), objUniform(ioRandom));
+
+        nData = ivData[std::min<int>((int)(itRank - vCumulative.begin()), nSize - 1)];
+    }
+
+    return vData;
+}
+
+//-------------------------------------------------------------------
+double MeasureSearches(BinaryTree *ipBinaryTree,
+                       const std::vector<int> &ivData,
+                       bool ibBranchless,
+                       bool ibRadixIndex,
+                       int &onFound)
+{
+    ipBinaryTree->SetBranchlessSearch(ibBranchless);
+
+    if (ibRadixIndex)
+    {
+        ipBinaryTree->EnableRadixIndex();
+    }
+
+    onFound = 0;
+
+    auto objStart = std::chrono::steady_clock::now();
+
+    for (auto nData : ivData)
+    {
+        onFound += ipBinaryTree->SearchInBinaryTree(nData);
+    }
+
+    auto objEnd = std::chrono::steady_clock::now();
+
+    ipBinaryTree->DisableRadixIndex();
+
+    return std::chrono::duration<double, std::nano>(objEnd - objStart).count() / ivData.size();
+}
+
+//-------------------------------------------------------------------
+template <typename Snapshot>
+double MeasureSnapshotSearches(Snapshot &iobjSnapshot,
+                               const std::vector<int> &ivData,
+                               int &onFound)
+{
+    onFound = 0;
+
+    auto objStart = std::chrono::steady_clock::now();
+
+    for (auto nData : ivData)
+    {
+        if constexpr (std::is_same_v<Snapshot, BPlusTree>)
+        {
+            onFound += iobjSnapshot.SearchInBinaryTree(nData);
+        }
+        else
+        {
+            onFound += iobjSnapshot.Search(nData);
+        }
+    }
+
+    auto objEnd = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(objEnd - objStart).count() / ivData.size();
+}
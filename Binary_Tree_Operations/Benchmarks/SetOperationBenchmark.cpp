@@ -0,0 +1,147 @@
+//-------------------------------------------------------------------
+/**
+ * @file SetOperationBenchmark.cpp
+ * @brief Benchmark of the set operations of two treaps
+ * @details Builds a large treap and smaller treaps of growing size overlapping half of its data, then
+ * measures the union, the intersection and the difference of both. The union is compared with inserting the
+ * data of the smaller treap one by one, which takes O(n log m) work instead of O(n log(m / n + 1)). Run it with
+ * `make benchmark`.
+ * @author Aditya Jedhe
+ * @date 2025-03-18
+ */
+//-------------------------------------------------------------------
+
+// ---------------------------------------------- Local Headers
+#include "BinaryTree.h"
+
+// ---------------------------------------------- System Headers
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+/**
+ * @brief Main function running the benchmark
+ */
+int main();
+
+/**
+ * @brief Creates a treap holding the given data
+ * @param[in] ivData Data to insert
+ * @return Pointer of created binary tree object
+ */
+BinaryTree *RetrieveTreap(const std::vector<int> &ivData);
+
+/**
+ * @brief Measures a set operation on fresh copies of both treaps
+ * @param[in] ivFirstData Data of the treap operated on
+ * @param[in] ivSecondData Data of the treap consumed by the operation
+ * @param[in] ipOperation Set operation of BinaryTree
+ * @return Milliseconds taken by the operation
+ */
+double MeasureSetOperation(const std::vector<int> &ivFirstData,
+                           const std::vector<int> &ivSecondData,
+                           void (BinaryTree::*ipOperation)(BinaryTree *&));
+
+//-------------------------------------------------------------------
+int main()
+{
+    const int nLargeNodes = 1 << 20;
+
+    std::mt19937 objRandom(2025);
+
+    std::vector<int> vLargeData(nLargeNodes);
+
+    std::iota(vLargeData.begin(), vLargeData.end(), 0);
+    std::transform(vLargeData.begin(), vLargeData.end(), vLargeData.begin(), [](int inData)
+                   { return 2 * inData; });
+    std::shuffle(vLargeData.begin(), vLargeData.end(), objRandom);
+
+    std::cout << std::setw(10) << "n"
+              << std::setw(14) << "Insert ms"
+              << std::setw(14) << "Union ms"
+              << std::setw(14) << "Intersect ms"
+              << std::setw(14) << "Diff ms" << std::endl;
+
+    for (int nSmallNodes : {1 << 10, 1 << 15, 1 << 20})
+    {
+        /**
+         * Half of the smaller data is present in the large treap, the
+         * other half falls between its data
+         */
+        std::uniform_int_distribution<int> objUniform(0, 2 * nLargeNodes - 1);
+
+        std::vector<int> vSmallData(nSmallNodes);
+
+        for (auto &nData : vSmallData)
+        {
+            nData = objUniform(objRandom);
+        }
+
+        std::sort(vSmallData.begin(), vSmallData.end());
+        vSmallData.erase(std::unique(vSmallData.begin(), vSmallData.end()), vSmallData.end());
+        std::shuffle(vSmallData.begin(), vSmallData.end(), objRandom);
+
+        BinaryTree *pBinaryTree = RetrieveTreap(vLargeData);
+
+        auto objStart = std::chrono::steady_clock::now();
+
+        for (auto nData : vSmallData)
+        {
+            if (!pBinaryTree->SearchInBinaryTree(nData))
+            {
+                pBinaryTree->InsertNodeInBinarySearchTree(nData);
+            }
+        }
+
+        auto objEnd = std::chrono::steady_clock::now();
+
+        BinaryTree::RemoveBinaryTree(pBinaryTree);
+
+        std::cout << std::setw(10) << vSmallData.size()
+                  << std::setw(14) << std::fixed << std::setprecision(2)
+                  << std::chrono::duration<double, std::milli>(objEnd - objStart).count()
+                  << std::setw(14) << MeasureSetOperation(vLargeData, vSmallData, &BinaryTree::Union)
+                  << std::setw(14) << MeasureSetOperation(vLargeData, vSmallData, &BinaryTree::Intersection)
+                  << std::setw(14) << MeasureSetOperation(vLargeData, vSmallData, &BinaryTree::Difference) << std::endl;
+    }
+
+    return 0;
+}
+
+//-------------------------------------------------------------------
+BinaryTree *RetrieveTreap(const std::vector<int> &ivData)
+{
+    BinaryTree *pBinaryTree = BinaryTree::CreateBinaryTree();
+
+    pBinaryTree->SetBalancingMode(BinaryTree::BALANCING_TREAP);
+
+    for (auto nData : ivData)
+    {
+        pBinaryTree->InsertNodeInBinarySearchTree(nData);
+    }
+
+    return pBinaryTree;
+}
+
+//-------------------------------------------------------------------
+double MeasureSetOperation(const std::vector<int> &ivFirstData,
+                           const std::vector<int> &ivSecondData,
+                           void (BinaryTree::*ipOperation)(BinaryTree *&))
+{
+    BinaryTree *pFirstBinaryTree = RetrieveTreap(ivFirstData);
+    BinaryTree *pSecondBinaryTree = RetrieveTreap(ivSecondData);
+
+    auto objStart = std::chrono::steady_clock::now();
+
+    (pFirstBinaryTree->*ipOperation)(pSecondBinaryTree);
+
+    auto objEnd = std::chrono::steady_clock::now();
+
+    BinaryTree::RemoveBinaryTree(pFirstBinaryTree);
+
+    return std::chrono::duration<double, std::milli>(objEnd - objStart).count();
+}
@@ -0,0 +1,275 @@
+//-------------------------------------------------------------------
+/**
+ * @file AdaptiveRadixTree.h
+ * @brief Header file for the AdaptiveRadixTree class.
+ * @author Aditya Jedhe
+ * @date 2025-03-15
+ */
+//-------------------------------------------------------------------
+
+#ifndef _ADAPTIVERADIXTREE_H_
+#define _ADAPTIVERADIXTREE_H_
+
+// ---------------------------------------------- System Headers
+#include <cstdint>
+
+// ---------------------------------------------- Forward declaration
+class Node;
+
+//-------------------------------------------------------------------
+/**
+ * @class AdaptiveRadixTree
+ * @brief Adaptive radix tree from the data of a node to the node.
+ * @details A data is split into its four bytes, most significant first and with the sign bit flipped so that
+ * the bytes order like the data. Each byte selects a child in one inner node, so a lookup takes exactly four
+ * hops whatever the number of data. An inner node grows from 4 to 16, 48 and 256 children as it fills up and
+ * shrinks back as children are removed, so a sparse level costs little memory while a dense level is indexed
+ * directly by the byte.
+ * @note Each data maps to a single node. Inserting a data already present keeps the node it maps to.
+ */
+class AdaptiveRadixTree
+{
+public:
+    /**
+     * @brief Constructor for AdaptiveRadixTree
+     */
+    AdaptiveRadixTree();
+
+    /**
+     * @brief Destructor for AdaptiveRadixTree
+     */
+    virtual ~AdaptiveRadixTree();
+
+    /**
+     * @brief Maps a data to a node unless the data is already present
+     * @param[in] inData Data of the node
+     * @param[in] ipNode Node to map the data to
+     * @return True if the data is added, false if it is already present
+     */
+    bool Insert(int inData,
+                Node *ipNode);
+
+    /**
+     * @brief Maps a data already present to another node
+     * @param[in] inData Data of the node
+     * @param[in] ipNode Node to map the data to
+     * @return True if the data is present, false otherwise
+     */
+    bool Replace(int inData,
+                 Node *ipNode);
+
+    /**
+     * @brief Removes a data
+     * @param[in] inData Data to remove
+     * @return True if the data is removed, false if it is not present
+     */
+    bool Remove(int inData);
+
+    /**
+     * @brief Finds the node a data maps to
+     * @param[in] inData Data to search for
+     * @return Node the data maps to. Otherwise nullptr.
+     */
+    Node *Find(int inData) const;
+
+    /**
+     * @brief Removes all data
+     */
+    void Clear();
+
+    /**
+     * @brief Returns the number of data present
+     * @return Number of data
+     */
+    int Size() const;
+
+private:
+    /**
+     * @brief Number of bytes of a data, which is the number of levels of inner nodes
+     */
+    static constexpr int _nLevels = 4;
+
+    /**
+     * @enum RadixNodeType
+     * @brief Capacity of an inner node
+     */
+    enum RadixNodeType : std::uint8_t
+    {
+        RADIX_NODE_4,
+        RADIX_NODE_16,
+        RADIX_NODE_48,
+        RADIX_NODE_256
+    };
+
+    /**
+     * @struct RadixNode
+     * @brief Header shared by all inner nodes
+     */
+    struct RadixNode
+    {
+        /**
+         * @brief Capacity of the inner node
+         */
+        RadixNodeType eType;
+
+        /**
+         * @brief Number of children
+         */
+        std::uint16_t nChildCount;
+    };
+
+    /**
+     * @struct RadixNode4
+     * @brief Inner node with up to 4 children, bytes kept sorted
+     */
+    struct RadixNode4 : RadixNode
+    {
+        /**
+         * @brief Bytes of the children
+         */
+        std::uint8_t anBytes[4];
+
+        /**
+         * @brief Children in the order of their bytes
+         */
+        void *apChildren[4];
+    };
+
+    /**
+     * @struct RadixNode16
+     * @brief Inner node with up to 16 children, bytes kept sorted and compared 16 at a time
+     */
+    struct RadixNode16 : RadixNode
+    {
+        /**
+         * @brief Bytes of the children
+         */
+        std::uint8_t anBytes[16];
+
+        /**
+         * @brief Children in the order of their bytes
+         */
+        void *apChildren[16];
+    };
+
+    /**
+     * @struct RadixNode48
+     * @brief Inner node with up to 48 children, a byte indexes the slot of its child plus one
+     */
+    struct RadixNode48 : RadixNode
+    {
+        /**
+         * @brief Slot of the child for each byte plus one, 0 for an absent child
+         */
+        std::uint8_t anSlots[256];
+
+        /**
+         * @brief Children, nullptr for a free slot
+         */
+        void *apChildren[48];
+    };
+
+    /**
+     * @struct RadixNode256
+     * @brief Inner node with a child per byte
+     */
+    struct RadixNode256 : RadixNode
+    {
+        /**
+         * @brief Child for each byte, nullptr for an absent child
+         */
+        void *apChildren[256];
+    };
+
+    /**
+     * @brief Splits a data into its bytes, most significant first
+     * @param[in] inData Data to split
+     * @param[out] oaBytes Bytes of the data, sign bit flipped
+     */
+    static void SplitData(int inData,
+                          std::uint8_t (&oaBytes)[_nLevels]);
+
+    /**
+     * @brief Returns the number of children an inner node of the given type holds
+     * @param[in] ieType Type of the inner node
+     * @return Capacity of the inner node
+     */
+    static int Capacity(RadixNodeType ieType);
+
+    /**
+     * @brief Creates an inner node of the given type from children sorted by byte
+     * @param[in] ieType Type of the inner node
+     * @param[in] ipBytes Bytes of the children
+     * @param[in] ipChildren Children
+     * @param[in] inCount Number of children
+     * @return Newly created inner node
+     */
+    static RadixNode *CreateRadixNode(RadixNodeType ieType,
+                                      const std::uint8_t *ipBytes,
+                                      void *const *ipChildren,
+                                      int inCount);
+
+    /**
+     * @brief Deletes an inner node without its children
+     * @param[in] ipNode Inner node to delete
+     */
+    static void DeleteRadixNode(RadixNode *ipNode);
+
+    /**
+     * @brief Deletes an inner node along with the inner nodes below it
+     * @param[in] ipNode Inner node to delete
+     * @param[in] inLevel Level of the inner node, children of the last level are tree nodes
+     */
+    static void DeleteSubRadixTree(RadixNode *ipNode,
+                                   int inLevel);
+
+    /**
+     * @brief Collects the children of an inner node sorted by byte
+     * @param[in] ipNode Inner node
+     * @param[out] opBytes Bytes of the children, room for 256
+     * @param[out] opChildren Children, room for 256
+     * @return Number of children
+     */
+    static int CollectChildren(const RadixNode *ipNode,
+                               std::uint8_t *opBytes,
+                               void **opChildren);
+
+    /**
+     * @brief Finds the slot of the child of an inner node for the given byte
+     * @param[in] ipNode Inner node
+     * @param[in] inByte Byte of the child
+     * @return Pointer to the slot holding the child. Otherwise nullptr.
+     */
+    static void **FindChild(RadixNode *ipNode,
+                            std::uint8_t inByte);
+
+    /**
+     * @brief Adds a child to the inner node held by a slot, growing the inner node when it is full
+     * @param[in,out] iopSlot Slot holding the inner node, updated if the inner node is replaced
+     * @param[in] inByte Byte of the child, not present yet
+     * @param[in] ipChild Child to add
+     */
+    static void AddChild(void **iopSlot,
+                         std::uint8_t inByte,
+                         void *ipChild);
+
+    /**
+     * @brief Removes a child from the inner node held by a slot, shrinking or deleting the inner node
+     * @param[in,out] iopSlot Slot holding the inner node, updated if the inner node is replaced or deleted
+     * @param[in] inByte Byte of the child, present
+     */
+    static void RemoveChild(void **iopSlot,
+                            std::uint8_t inByte);
+
+    /**
+     * @brief Root inner node, nullptr when no data is present
+     */
+    void *_pRootNode;
+
+    /**
+     * @brief Number of data present
+     */
+    int _nSize;
+};
+
+#endif // _ADAPTIVERADIXTREE_H_
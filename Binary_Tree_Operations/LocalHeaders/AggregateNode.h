@@ -0,0 +1,136 @@
+//-------------------------------------------------------------------
+/**
+ * @file AggregateNode.h
+ * @brief Header file for the AggregateNode class.
+ * @author Aditya Jedhe
+ * @date 2025-03-19
+ */
+//-------------------------------------------------------------------
+
+#ifndef _AGGREGATENODE_H_
+#define _AGGREGATENODE_H_
+
+// ---------------------------------------------- Local Headers
+#include "AugmentedNode.h"
+
+//-------------------------------------------------------------------
+/**
+ * @class AggregateNode
+ * @brief Node carrying a value along with the summary of the values of its sub-binary tree.
+ * @details The summary is a monoid: Combine() is associative and Empty() is its identity, so the summary of a
+ * sub-binary tree is the combination of the summaries of its left child, of the node itself and of its right
+ * child, in this order. A binary tree keeps the summaries by recomputing them bottom-up for the nodes whose
+ * children change, and answers an aggregate over an interval of data by combining O(depth) summaries.
+ * @note Another aggregate is added by extending Summary, Combine() and Empty().
+ */
+class AggregateNode : public AugmentedNode
+{
+public:
+    /**
+     * @struct Summary
+     * @brief Aggregate of the values of a set of nodes
+     */
+    struct Summary
+    {
+        /**
+         * @brief Sum of the values
+         */
+        long long nSum;
+
+        /**
+         * @brief Smallest value, meaningless for an empty set
+         */
+        int nMin;
+
+        /**
+         * @brief Largest value, meaningless for an empty set
+         */
+        int nMax;
+
+        /**
+         * @brief Number of nodes
+         */
+        int nCount;
+    };
+
+    /**
+     * @brief Constructor for AggregateNode
+     * @param[in] inData Data element to store in the node
+     * @param[in] inValue Value carried by the node
+     */
+    AggregateNode(const int inData = 0,
+                  const int inValue = 0);
+
+    /**
+     * @brief Destructor for AggregateNode
+     */
+    virtual ~AggregateNode();
+
+    /**
+     * @brief Retrieves the value carried by the node
+     * @return Value of the node
+     * @note It is a constant member function.
+     */
+    int GetValue() const;
+
+    /**
+     * @brief Sets the value carried by the node
+     * @param[in] inValue Value of the node
+     * @note The summaries of the node and of its ancestors must be updated afterwards.
+     */
+    void SetValue(int inValue);
+
+    /**
+     * @brief Retrieves the summary of the sub-binary tree of the node
+     * @return Summary of the values of the sub-binary tree
+     * @note It is a constant member function.
+     */
+    const Summary &GetSummary() const;
+
+    /**
+     * @brief Recomputes the summary of the sub-binary tree from the summaries of the children
+     */
+    void UpdateSummary();
+
+    /**
+     * @brief Returns the summary of a sub-binary tree
+     * @param[in] ipNode Root of the sub-binary tree, an AggregateNode or nullptr
+     * @return Summary of the sub-binary tree, Empty() for nullptr
+     */
+    static Summary SummaryOf(const Node *ipNode);
+
+    /**
+     * @brief Returns the summary of the node alone
+     * @param[in] ipNode Node, an AggregateNode
+     * @return Summary of the value of the node
+     */
+    static Summary SummaryOfValue(const Node *ipNode);
+
+    /**
+     * @brief Combines the summaries of two adjacent sets of nodes
+     * @param[in] iobjFirst Summary of the nodes of smaller data
+     * @param[in] iobjSecond Summary of the nodes of larger data
+     * @return Summary of both sets
+     */
+    static Summary Combine(const Summary &iobjFirst,
+                           const Summary &iobjSecond);
+
+    /**
+     * @brief Returns the summary of an empty set of nodes
+     * @return Identity of Combine()
+     */
+    static Summary Empty();
+
+private:
+    /**
+     * @brief Value carried by the node
+     */
+    int _nValue;
+
+    /**
+     * @brief Summary of the values of the sub-binary tree of the node
+     */
+    Summary _objSummary;
+};
+
+#endif // _AGGREGATENODE_H_
@@ -0,0 +1,77 @@
+//-------------------------------------------------------------------
+/**
+ * @file AugmentedNode.h
+ * @brief Header file for the AugmentedNode class.
+ * @author Aditya Jedhe
+ * @date 2025-03-21
+ */
+//-------------------------------------------------------------------
+
+#ifndef _AUGMENTEDNODE_H_
+#define _AUGMENTEDNODE_H_
+
+// ---------------------------------------------- Project Headers
+#include "Node.h"
+
+//-------------------------------------------------------------------
+/**
+ * @class AugmentedNode
+ * @brief Node carrying the size and the height of its sub-binary tree.
+ * @details A binary tree allocates its nodes as AugmentedNode only once order statistics or subtree heights are
+ * enabled, so a plain Node keeps its size for every other binary tree. Both fields are kept up to date by the
+ * binary tree, which recomputes them bottom-up for the nodes whose children change.
+ */
+class AugmentedNode : public Node
+{
+public:
+    /**
+     * @brief Constructor for AugmentedNode
+     * @param[in] inData Data element to store in the node
+     * @note The node starts as a leaf node: a size of 1 and a height of 0.
+     */
+    AugmentedNode(const int inData = 0);
+
+    /**
+     * @brief Destructor for AugmentedNode
+     */
+    virtual ~AugmentedNode();
+
+    /**
+     * @brief Retrieves the number of occurrences in the sub-binary tree of the node
+     * @return Number of occurrences, the node's own included
+     * @note It is a constant member function.
+     */
+    int GetSize() const;
+
+    /**
+     * @brief Sets the number of occurrences in the sub-binary tree of the node
+     * @param[in] inSize Number of occurrences, the node's own included
+     */
+    void SetSize(int inSize);
+
+    /**
+     * @brief Retrieves the height of the sub-binary tree of the node
+     * @return Number of edges on the longest path down to a leaf node, 0 for a leaf node
+     * @note It is a constant member function.
+     */
+    int GetHeight() const;
+
+    /**
+     * @brief Sets the height of the sub-binary tree of the node
+     * @param[in] inHeight Number of edges on the longest path down to a leaf node
+     */
+    void SetHeight(int inHeight);
+
+private:
+    /**
+     * @brief Number of occurrences in the sub-binary tree of the node
+     */
+    int _nSize;
+
+    /**
+     * @brief Height of the sub-binary tree of the node
+     */
+    int _nHeight;
+};
+
+#endif // _AUGMENTEDNODE_H_
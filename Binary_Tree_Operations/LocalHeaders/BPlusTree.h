@@ -0,0 +1,282 @@
+//-------------------------------------------------------------------
+/**
+ * @file BPlusTree.h
+ * @brief Header file for the BPlusTree class.
+ * @author Aditya Jedhe
+ * @date 2025-03-13
+ */
+//-------------------------------------------------------------------
+
+#ifndef _BPLUSTREE_H_
+#define _BPLUSTREE_H_
+
+// ---------------------------------------------- System Headers
+#include <vector>
+
+//-------------------------------------------------------------------
+/**
+ * @class BPlusTree
+ * @brief Search tree holding up to 15 sorted data per node, the data of a node filling one cache line.
+ * @details A binary node uses a few bytes of each 64-byte line it loads, so a lookup costs about one cache miss per
+ * level of log2(n) levels. Here the 15 data of a node and the number of data share one aligned line, which is
+ * compared with the searched data as a whole with SIMD compares and a movemask, so a level costs one line and
+ * about four binary levels are resolved at once. The pointers of an inner node to its 16 children fill the next
+ * two lines and are prefetched while the data is compared. The leaves hold the data with their number of
+ * occurrences and are linked from left to right for in-order traversals.
+ * @note The public member functions carry the names of their BinaryTree counterparts, so code written against
+ * that surface can use either class.
+ * @note Every node but the root node holds at least 7 data. A deletion refills a node left with fewer from a
+ * sibling, or merges it with the sibling, so the leaves stay at least half full and the tree loses a level once
+ * its root node is left with a single child.
+ */
+class BPlusTree
+{
+public:
+    /**
+     * @brief Creates the B+ tree
+     * @return Pointer of created B+ tree object
+     * @see RemoveBPlusTree() for deleting the B+ tree
+     * @note This method is static method
+     */
+    static BPlusTree *CreateBPlusTree();
+
+    /**
+     * @brief Deletes the B+ tree
+     * @param[in, out] iopBPlusTree created B+ tree object
+     * @note This method is static method
+     */
+    static void RemoveBPlusTree(BPlusTree *&iopBPlusTree);
+
+    /**
+     * @brief Checks if the B+ tree is empty
+     * @return True if the B+ tree is empty, false otherwise
+     */
+    bool IsEmpty();
+
+    /**
+     * @brief Inserts a new data into the B+ tree
+     * @details A data which is already present counts one more occurrence. A full leaf is split into two leaves
+     * of 8 data, which may split its parent and so on up to the root node.
+     * @param[in] inData Data to insert
+     */
+    void InsertNodeInBinarySearchTree(int inData);
+
+    /**
+     * @brief Deletes one occurrence of a data from the B+ tree
+     * @details A data with several occurrences counts one less. Otherwise it is removed from its leaf, and a leaf
+     * left with fewer than 7 data takes one from a sibling holding more, or is merged with a sibling, which may
+     * leave its parent short in turn and so on up to the root node.
+     * @param[in] inData Data to delete
+     */
+    void DeleteBinaryTreeNode(int inData);
+
+    /**
+     * @brief Searches for a data in the B+ tree
+     * @param[in] inData Data to be searched in the B+ tree
+     * @return True if the data is present, false otherwise
+     */
+    bool SearchInBinaryTree(int inData);
+
+    /**
+     * @brief Performs an in-order traversal of the B+ tree
+     * @details Prints all data in sorted sequence. A data with several occurrences is printed once as
+     * data'x'count, unless expanded.
+     * @param[in] ibExpandDuplicates True to print a data once per occurrence
+     */
+    void InOrderTraversal(bool ibExpandDuplicates = false);
+
+    /**
+     * @brief Performs a level-order traversal of the B+ tree
+     * @details Prints the data of each node in brackets, level by level.
+     */
+    void LevelOrderTraversal();
+
+    /**
+     * @brief Retrieves all data in sorted sequence
+     * @param[in, out] iovData Vector the data is appended to
+     * @param[in] ibExpandDuplicates True to add a data once per occurrence
+     */
+    void RetrieveInOrderData(std::vector<int> &iovData,
+                             bool ibExpandDuplicates = true);
+
+    /**
+     * @brief Returns the height of the B+ tree
+     * @details The number of edges between the root node and any leaf, all leaves being at the same depth.
+     * @return Height of the B+ tree, -1 if it is empty
+     */
+    int HeightOfBinaryTree();
+
+private:
+    /**
+     * @struct InnerNode
+     * @brief Node routing a search to one of its children
+     * @details Child i holds the data not less than anKeys[i - 1] and less than anKeys[i].
+     */
+    struct alignas(64) InnerNode
+    {
+        /**
+         * @brief Sorted separating data, only the first nKeyCount are valid
+         */
+        int anKeys[15];
+
+        /**
+         * @brief Number of valid separating data
+         */
+        int nKeyCount;
+
+        /**
+         * @brief Children, nKeyCount + 1 of them. They are inner nodes above the last level, leaves on it.
+         */
+        void *apChildNodes[16];
+    };
+
+    /**
+     * @struct LeafNode
+     * @brief Node holding the data
+     */
+    struct alignas(64) LeafNode
+    {
+        /**
+         * @brief Sorted data, only the first nKeyCount are valid
+         */
+        int anKeys[15];
+
+        /**
+         * @brief Number of valid data
+         */
+        int nKeyCount;
+
+        /**
+         * @brief Number of occurrences of each data
+         */
+        int anCounts[15];
+
+        /**
+         * @brief Next leaf to the right, nullptr for the last leaf
+         */
+        LeafNode *pNextLeafNode;
+    };
+
+    /**
+     * @brief Maximum number of data in a node
+     */
+    static constexpr int _nMaxKeyCount = 15;
+
+    /**
+     * @brief Minimum number of data in a node other than the root node
+     */
+    static constexpr int _nMinKeyCount = _nMaxKeyCount / 2;
+
+    /**
+     * @brief Maximum number of inner levels, enough for any number of int data
+     */
+    static constexpr int _nMaxInnerLevels = 32;
+
+    /**
+     * @brief Constructor for BPlusTree
+     */
+    BPlusTree();
+
+    /**
+     * @brief Destructor for BPlusTree
+     */
+    virtual ~BPlusTree();
+
+    /**
+     * @brief Counts the valid data of a node which are less than (or equal to) the given data
+     * @details The 16 ints of the data line are compared at once with AVX2 or SSE2 where available. The lane
+     * holding the number of data is masked out with the unused slots.
+     * @param[in] ipKeys Data line of a node, aligned to 64 bytes
+     * @param[in] inKeyCount Number of valid data
+     * @param[in] inData Data to compare with
+     * @param[in] ibInclusive True to count the data equal to the given data as well
+     * @return Number of counted data
+     */
+    static int CountKeysBelow(const int *ipKeys,
+                              int inKeyCount,
+                              int inData,
+                              bool ibInclusive);
+
+    /**
+     * @brief Finds the leaf which holds or would hold the given data
+     * @param[in] inData Data to search for
+     * @param[out] oapPath Inner nodes from the root node down, nullptr to skip
+     * @param[out] oanPathIdx Index of the child taken in each inner node, nullptr to skip
+     * @return Pointer of the leaf
+     */
+    LeafNode *FindLeafNode(int inData,
+                           InnerNode **oapPath,
+                           int *oanPathIdx);
+
+    /**
+     * @brief Inserts a separating data and the node right of it into an inner node on the path
+     * @param[in] iapPath Inner nodes from the root node down to the parent of the split node
+     * @param[in] ianPathIdx Index of the child taken in each inner node
+     * @param[in] inLevel Level of the inner node to insert into, -1 to add a new root node
+     * @param[in] inKey Separating data
+     * @param[in] ipRightNode Node holding the data not less than inKey
+     */
+    void InsertIntoInnerNode(InnerNode **iapPath,
+                             int *ianPathIdx,
+                             int inLevel,
+                             int inKey,
+                             void *ipRightNode);
+
+    /**
+     * @brief Brings the leaf at the end of the path back to the minimum number of data
+     * @details Takes the nearest data of a sibling holding more than the minimum, updating the separating data
+     * in the parent. Otherwise merges the leaf with a sibling and removes the right one of the pair from the
+     * parent.
+     * @param[in] iapPath Inner nodes from the root node down to the parent of the leaf
+     * @param[in] ianPathIdx Index of the child taken in each inner node
+     */
+    void RefillLeafNode(InnerNode **iapPath,
+                        int *ianPathIdx);
+
+    /**
+     * @brief Brings an inner node on the path back to the minimum number of separating data
+     * @details Rotates a separating data and a child through the parent from a sibling holding more than the
+     * minimum. Otherwise merges the node, the separating data of the parent and a sibling into one node.
+     * @param[in] iapPath Inner nodes from the root node down
+     * @param[in] ianPathIdx Index of the child taken in each inner node
+     * @param[in] inLevel Level of the inner node, not the root node
+     */
+    void RefillInnerNode(InnerNode **iapPath,
+                         int *ianPathIdx,
+                         int inLevel);
+
+    /**
+     * @brief Removes a child and the separating data in front of it from an inner node on the path
+     * @details An inner node left short is refilled, and a root node left with a single child is replaced by it.
+     * @param[in] iapPath Inner nodes from the root node down
+     * @param[in] ianPathIdx Index of the child taken in each inner node
+     * @param[in] inLevel Level of the inner node
+     * @param[in] inChildIdx Index of the removed child, at least 1
+     */
+    void RemoveFromInnerNode(InnerNode **iapPath,
+                             int *ianPathIdx,
+                             int inLevel,
+                             int inChildIdx);
+
+    /**
+     * @brief Represents the root node, an inner node unless the B+ tree is a single leaf
+     */
+    void *_pRootNode;
+
+    /**
+     * @brief Leftmost leaf, where in-order traversals start
+     */
+    LeafNode *_pFirstLeafNode;
+
+    /**
+     * @brief Number of inner levels above the leaves
+     */
+    int _nInnerLevels;
+
+    /**
+     * @brief Number of occurrences of all data
+     */
+    int _nDataCount;
+};
+
+#endif // _BPLUSTREE_H_
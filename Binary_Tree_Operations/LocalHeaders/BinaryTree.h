@@ -8,11 +8,18 @@
 //-------------------------------------------------------------------
 
 // ---------------------------------------------- System Headers
+#include <atomic>
+#include <cstdint>
+#include <istream>
 #include <stack>
 #include <vector>
 
 // ---------------------------------------------- Forward declaration
+class AdaptiveRadixTree;
+class BloomFilter;
+class DenseKeyBitmap;
 class Node;
+class NodeIndex;
 
 //-------------------------------------------------------------------
 /**
@@ -26,6 +33,38 @@ class Node;
 class BinaryTree
 {
 public:
+    /**
+     * @enum BalancingMode
+     * @brief How the insertions into and deletions from the binary search tree bound its depth
+     */
+    enum BalancingMode
+    {
+        /**
+         * @brief Nodes are linked where the descent ends, a sorted stream degrades the tree to a list
+         */
+        BALANCING_NONE,
+
+        /**
+         * @brief Nodes are coloured and rotated as a red-black tree, the depth stays within 2 * log2(n + 1)
+         */
+        BALANCING_RED_BLACK,
+
+        /**
+         * @brief Searched and inserted nodes are splayed to the root node, frequently searched data stays near it
+         */
+        BALANCING_SPLAY,
+
+        /**
+         * @brief No per-operation rebalancing, a sub-binary tree grown too deep is rebuilt in perfect balance
+         */
+        BALANCING_SCAPEGOAT,
+
+        /**
+         * @brief Nodes are kept in heap order of a hash of their data, the expected depth is O(log n)
+         */
+        BALANCING_TREAP
+    };
+
     /**
      * @brief Creates the binary tree
      * @return Pointer of created binary tree object
@@ -34,8 +73,52 @@ public:
      */
     static BinaryTree *CreateBinaryTree();
 
+    /**
+     * @brief Creates the binary tree from its pre-order and in-order sequences
+     * @details The tree is rebuilt in O(n) without recursion. A key-to-position index of the in-order sequence
+     * tells for each data of the pre-order sequence whether it is a left child of the previous node or the right
+     * child of one of its ancestors.
+     * @param[in] ivPreOrder Data of the binary tree in pre-order sequence
+     * @param[in] ivInOrder Data of the binary tree in in-order sequence
+     * @return Pointer of created binary tree object. nullptr if the sequences are empty, hold duplicate data or
+     * do not describe the same binary tree.
+     * @see RemoveBinaryTree() for deleting the binary tree
+     * @note This method is static method
+     */
+    static BinaryTree *CreateBinaryTreeFromPreOrderAndInOrder(const std::vector<int> &ivPreOrder,
+                                                              const std::vector<int> &ivInOrder);
+
+    /**
+     * @brief Creates the binary tree from its post-order and in-order sequences
+     * @details The post-order sequence read backwards is the mirrored pre-order sequence, so the tree is rebuilt
+     * the same way as by CreateBinaryTreeFromPreOrderAndInOrder() with left and right swapped.
+     * @param[in] ivPostOrder Data of the binary tree in post-order sequence
+     * @param[in] ivInOrder Data of the binary tree in in-order sequence
+     * @return Pointer of created binary tree object. nullptr if the sequences are empty, hold duplicate data or
+     * do not describe the same binary tree.
+     * @see RemoveBinaryTree() for deleting the binary tree
+     * @note This method is static method
+     */
+    static BinaryTree *CreateBinaryTreeFromPostOrderAndInOrder(const std::vector<int> &ivPostOrder,
+                                                               const std::vector<int> &ivInOrder);
+
+    /**
+     * @brief Creates a balanced binary search tree from a sorted stream of data
+     * @details The data is read once, front to back, and each node is allocated as soon as its data is read.
+     * The sub-binary tree left of a node is completed before the node's data is read, so only the partial
+     * spine of O(log n) nodes whose right sub-binary tree is pending is held while the stream is consumed.
+     * @param[in, out] ioStream Stream of whitespace separated data in non-decreasing order, e.g. a file or a pipe
+     * @param[in] inCount Number of data to read from the stream
+     * @return Pointer of created binary tree object. nullptr if the stream ends early or is not sorted.
+     * @see RemoveBinaryTree() for deleting the binary tree
+     * @note This method is static method
+     */
+    static BinaryTree *CreateBinarySearchTreeFromSortedStream(std::istream &ioStream,
+                                                              int inCount);
+
     /**
      * @brief Deletes the binary tree
+     * @details Frees the nodes, if any, and the binary tree object itself, so an empty binary tree is deleted too.
      * @param[in, out] iopBinaryTree created binary tree object
      * @note This method is static method
      */
@@ -56,6 +139,23 @@ public:
      */
     void InsertNodeInBinaryTree(int inData);
 
+    /**
+     * @brief Inserts a new node into a complete binary tree from any thread.
+     * @details Each caller atomically claims the next slot index of the complete binary tree and links its node
+     * below the parent of that slot, which is reached by following the bits of the slot index from the root node.
+     * Claiming a slot takes no lock, but linking is blocking: a caller whose parent slot is still being linked by
+     * another thread spin-waits, yielding, until that node is published. A thread stalled between claiming its
+     * slot and linking its node therefore stalls every insertion below that slot.
+     * @param[in] inData The integer value to be inserted into the binary tree.
+     * @note A node is linked only after it is fully constructed, so readers using Node::AcquireLeftNode() and
+     * Node::AcquireRightNode() never see a partially linked node. SearchInBinaryTree() with a single data reads
+     * the links of a complete binary tree that way and may run alongside.
+     * @warning The tree must be complete, i.e. built by InsertNodeInBinaryTree() only. No other operation, be it
+     * a modification, any other query or a traversal, may run at the same time: they read the links without
+     * ordering.
+     */
+    void ConcurrentInsertNodeInBinaryTree(int inData);
+
     /**
      * @brief Inserts a new data into the binary search tree
      * @details The binary search tree is a data structure in which each node has at
@@ -67,20 +167,439 @@ public:
      */
     void InsertNodeInBinarySearchTree(int inData);
 
+    /**
+     * @brief Inserts a new data into the binary search tree starting from the last insertion point
+     * @details The finger remembers the path to the node inserted last, together with the range of data each
+     * node on the path may hold. The search climbs the path only until the range covers the new data and
+     * descends from there. A red-black tree and a treap then run their usual rebalancing on the finger path,
+     * and only the part of the path below the highest rotation is descended again, so a nearly-sorted stream
+     * costs O(log d) amortised, where d is the distance from the previous data, instead of a full descent from
+     * the root node. An unbalanced tree keeps the finger as well but degenerates on sorted data, and a splay
+     * tree and a scapegoat tree, which restructure whole paths, always insert from the root node.
+     * @note Augmentations are updated on every ancestor, so an augmented tree still costs O(depth).
+     * @param[in] inData Data to insert
+     * @see InsertNodeInBinarySearchTree() for the insertion from the root node
+     */
+    void InsertNodeInBinarySearchTreeFromFinger(int inData);
+
+    /**
+     * @brief Enables or disables the multiset mode of the binary search tree
+     * @details In multiset mode a node carries the number of occurrences of its data. Inserting a data which is
+     * already present increments that count instead of adding a node to the right sub-binary tree.
+     * @param[in] ibMultiset True to count duplicates in their node, false to insert them as separate nodes
+     * @note Nodes inserted earlier keep their position, only the following insertions are affected.
+     */
+    void SetMultisetMode(bool ibMultiset);
+
+    /**
+     * @brief Selects the kernel descending the binary search tree on a search
+     * @details The branchy kernel stops at the first node holding the data, but the direction taken at each
+     * node is a conditional jump which is mispredicted about every other level on random data. The branchless
+     * kernel always descends to a leaf, selecting the child by indexing Node::GetChildNode() with the result
+     * of the comparison and remembering the last node not smaller than the data with a conditional move.
+     * The only branch left is the loop exit, which is predicted right on every level but the last.
+     * @param[in] ibBranchless True for the branchless kernel, false for the branchy kernel (default)
+     * @note The branchy kernel stays the default since a mispredicted branch still starts loading the next node
+     * early, while the branchless kernel waits for every load and always descends to a leaf. Run
+     * Benchmarks/SearchKernelBenchmark.cpp to compare both on the target machine.
+     * @note With duplicate data the two kernels may find different nodes holding the same data.
+     */
+    void SetBranchlessSearch(bool ibBranchless);
+
+    /**
+     * @brief Selects how the binary search tree bounds its depth
+     * @details In red-black mode InsertNodeInBinarySearchTree() and DeleteBinaryTreeNode() recolour the nodes
+     * on the path to the root and rotate at most three times, so every search, traversal and query of the
+     * height keeps working unchanged on a tree of logarithmic depth. The colour is kept in spare bits of the
+     * node, so a node takes no more memory.
+     * In splay mode SearchInBinaryTree() and InsertNodeInBinarySearchTree() rotate the node reached to the root
+     * node, so a data searched often stays one or two levels deep. Any sequence of m operations costs
+     * O(m log n), although a single one may take O(n).
+     * In scapegoat mode the insertions and deletions do not rotate. An insertion deeper than log_{3/2}(n) walks
+     * back up to the first ancestor whose larger sub-binary tree holds more than 2/3 of its nodes and rebuilds
+     * only that sub-binary tree in perfect balance, in place by Day-Stout-Warren rotations reusing its nodes.
+     * Once deletions shrink the tree below 2/3 of its largest size the whole tree is rebuilt. Insertions and
+     * deletions take O(log n) amortised time and the depth stays within log_{3/2}(n) + 1.
+     * In treap mode each node has a priority hashed from its data and the tree is kept in heap order of the
+     * priorities. An insertion rotates the new leaf up past the ancestors of lower priority, a deletion joins
+     * the two sub-binary trees of the node. Since the shape only depends on the data, two treaps can be split
+     * and joined in O(log n) expected time, which Split(), Join() and the set operations build on. The priority
+     * is recomputed from the data, so a node takes no more memory.
+     * @param[in] ieMode Balancing mode, BALANCING_NONE by default
+     * @note In splay mode a search modifies the binary tree, so searches must not run concurrently. The batch
+     * search, the structural queries and a search answered by the dense key bitmap or the radix index do not
+     * splay.
+     * @note The mode can only be changed on an empty binary tree. While a tree is balanced the level-order
+     * insertions are refused, since they would break the binary search tree property.
+     */
+    void SetBalancingMode(BalancingMode ieMode);
+
     /**
      * @brief Deletes a data from the binary tree
+     * @details A node holding several occurrences of the data only counts one less. Otherwise the node is
+     * removed: in a binary search tree its in-order successor takes its place, in any other binary tree the
+     * last node in level order does, which keeps a complete binary tree complete.
      * @param[in] inData Data to delete
-     * @warning not implemented
      */
     void DeleteBinaryTreeNode(int inData);
 
+    /**
+     * @brief Moves the data not less than the given data into a new binary tree
+     * @details The nodes are moved, not copied. A treap, a scapegoat tree and an unbalanced binary search tree
+     * are split along the search path of the data, which keeps a treap a treap. A splay tree is splayed at the
+     * data first. A red-black tree is taken apart along the search path and each part is joined back from the
+     * deepest node up by its black height, in O(log n) all together.
+     * @param[in] inData Smallest data to move
+     * @return Pointer of created binary tree object holding the moved data, in the same modes. It is empty when no
+     * data is moved, and this binary tree is left empty when all data is moved. nullptr unless the binary tree is
+     * a binary search tree.
+     * @see RemoveBinaryTree() for deleting the binary tree
+     * @note The moved nodes are counted from the subtree sizes while order statistics are enabled outside multiset
+     * mode. Otherwise both parts are walked in turn until the smaller one is counted, which takes time linear in
+     * its number of nodes. A split scapegoat tree keeps the depth of the whole binary tree until it is rebuilt.
+     * @note The bounds leave out the auxiliary structures of both binary trees. A Bloom filter or a radix index
+     * enabled on this binary tree is enabled on the new one as well, and both are refilled in time linear in the
+     * number of nodes. So is the dense key bitmap of either binary tree whose range of data is dense enough to
+     * keep one, while a sparse range is read off the outermost paths in O(depth).
+     */
+    BinaryTree *Split(int inData);
+
+    /**
+     * @brief Moves all nodes of another binary tree into this one, their ranges of data not overlapping
+     * @details Both treaps are joined along their facing spines in O(log n) expected time. Two red-black trees
+     * are linked below the smallest node of the larger data, taken out of its red-black tree, on the spine of
+     * the taller one where the black heights meet, in O(log n). The largest node of a splay tree is splayed to
+     * its root node to take the other splay tree as right child. The root nodes of any other binary search
+     * trees are linked below the smallest node of the larger data, in O(depth).
+     * @param[in, out] iopBinaryTree Binary tree whose data all lie above or all below the data of this one.
+     * Deleted and set to nullptr once its nodes are moved.
+     * @note Both binary trees must be binary search trees in the same balancing mode.
+     * @note The auxiliary structures are rebuilt as after Split(), in time linear in the number of nodes if a
+     * Bloom filter, a radix index or a dense key bitmap has to be refilled.
+     */
+    void Join(BinaryTree *&iopBinaryTree);
+
+    /**
+     * @brief Moves the data of another binary tree into this one
+     * @details The treap of higher root priority is split at the data of its root node and both halves are
+     * united with the two sub-binary trees of that node. The left half is offered to the process-wide
+     * ForkJoinPool down to a depth of log2 of the hardware threads, as long as a half keeps about 4096 nodes, so
+     * small treaps are united on the calling thread alone. For sizes n <= m this takes O(n log(m / n + 1)) expected work and
+     * O(log n log m) expected span. A data present in both binary trees keeps a single node, in multiset mode
+     * counting the occurrences of both.
+     * @param[in, out] iopBinaryTree Binary tree to unite with. Deleted and set to nullptr.
+     * @note Both binary trees must be in treap mode.
+     * @note The bounds leave out the auxiliary structures rebuilt afterwards: an enabled Bloom filter or radix
+     * index is refilled in time linear in the number of nodes, and so is the dense key bitmap when the range of
+     * the data is dense enough to keep one. Otherwise the range is read off the outermost paths in O(depth).
+     */
+    void Union(BinaryTree *&iopBinaryTree);
+
+    /**
+     * @brief Keeps only the data also present in another binary tree
+     * @details Divides and conquers like Union(), freeing the nodes whose data is missing from the other
+     * binary tree. In multiset mode a node keeps the smaller of both counts.
+     * @param[in, out] iopBinaryTree Binary tree to intersect with. Deleted and set to nullptr.
+     * @note Both binary trees must be in treap mode.
+     * @note Freeing the nodes left out takes time linear in their number, on top of the bound of Union(). The
+     * auxiliary structures are rebuilt as after Union().
+     */
+    void Intersection(BinaryTree *&iopBinaryTree);
+
+    /**
+     * @brief Removes the data present in another binary tree
+     * @details Divides and conquers like Union(), always splitting the other binary tree at the root node of
+     * this one. In multiset mode the occurrences of the other binary tree are subtracted.
+     * @param[in, out] iopBinaryTree Binary tree whose data is removed. Deleted and set to nullptr.
+     * @note Both binary trees must be in treap mode. The auxiliary structures are rebuilt as after Union().
+     */
+    void Difference(BinaryTree *&iopBinaryTree);
+
+    /**
+     * @brief Builds and maintains a hash index from data to node, parent node and depth
+     * @details Once enabled, insertions and deletions keep the index up to date, and the queries for sibling,
+     * cousins, ancestors, descendants and level of a data start from the index in O(1) instead of searching
+     * the binary tree.
+     * @param[in] inExpectedCount Number of nodes to reserve space for, so a bulk load does not grow the index
+     * @note Only a complete binary tree can be indexed. The index is dropped as soon as the binary tree stops
+     * being complete.
+     * @see DisableNodeIndex() for dropping the index
+     */
+    void EnableNodeIndex(int inExpectedCount = 0);
+
+    /**
+     * @brief Drops the hash index from data to node
+     */
+    void DisableNodeIndex();
+
+    /**
+     * @brief Builds and maintains a Bloom filter in front of the searches
+     * @details Every search first asks the filter, which answers "definitely absent" from a single cache line
+     * so that a miss does not walk the binary tree. Insertions add their data to the filter.
+     * @param[in] inExpectedCount Number of data the filter is sized for
+     * @param[in] idFalsePositiveRate Probability that an absent data still goes on to search the binary tree
+     * @note Deleted data stays in the filter and only costs a futile search. Call RebuildBloomFilter() after
+     * bulk deletions.
+     * @see DisableBloomFilter() for dropping the filter
+     */
+    void EnableBloomFilter(int inExpectedCount,
+                           double idFalsePositiveRate = 0.01);
+
+    /**
+     * @brief Rebuilds the Bloom filter from the data present in the binary tree
+     * @details The filter is resized to the current number of nodes if it has outgrown its size.
+     */
+    void RebuildBloomFilter();
+
+    /**
+     * @brief Drops the Bloom filter
+     */
+    void DisableBloomFilter();
+
+    /**
+     * @brief Builds and maintains an adaptive radix tree from data to node
+     * @details Once enabled, a search is answered by four byte-wise hops through the radix tree instead of a
+     * walk of the binary tree, whatever the shape of the binary tree. Insertions and deletions keep the radix
+     * tree up to date, while the structural queries keep working on the binary tree itself.
+     * @note Concurrent insertions are refused while the radix tree is enabled.
+     * @see DisableRadixIndex() for dropping the radix tree
+     */
+    void EnableRadixIndex();
+
+    /**
+     * @brief Drops the adaptive radix tree from data to node
+     */
+    void DisableRadixIndex();
+
+    /**
+     * @brief Builds and maintains the number of occurrences in the sub-binary tree of every node
+     * @details Once enabled, insertions, deletions and every rotation or relink of the balancing modes update
+     * the sizes along the path they touch, so Rank(), Select(), KthSmallest(), KthLargest() descend a single
+     * path and CountOfData() reads the size of the root node. The nodes are reallocated as AugmentedNode unless
+     * subtree heights already did so, so a cursor on the binary tree must be positioned again afterwards.
+     * @note Only a binary search tree can be augmented. The sizes are dropped as soon as a level-order insertion
+     * breaks the binary search tree property, and concurrent insertions are refused while they are kept.
+     * @see DisableOrderStatistics() for dropping the sizes
+     */
+    void EnableOrderStatistics();
+
+    /**
+     * @brief Stops maintaining the sizes of the sub-binary trees
+     */
+    void DisableOrderStatistics();
+
+    /**
+     * @brief Builds and maintains the height of the sub-binary tree of every node
+     * @details Once enabled, the heights are recomputed bottom-up along the same paths as the sizes of order
+     * statistics, so HeightOfBinaryTree() and HeightOfSubBinaryTree() read a single node instead of walking the
+     * sub-binary tree. The nodes are reallocated as AugmentedNode unless order statistics already did so, so a
+     * cursor on the binary tree must be positioned again afterwards.
+     * @note Only a binary search tree can be augmented. The heights are dropped as soon as a level-order
+     * insertion breaks the binary search tree property; the height of a complete binary tree follows from its
+     * node count anyway.
+     * @see DisableSubtreeHeights() for dropping the heights
+     */
+    void EnableSubtreeHeights();
+
+    /**
+     * @brief Stops maintaining the heights of the sub-binary trees
+     */
+    void DisableSubtreeHeights();
+
+    /**
+     * @brief Makes every node carry a value and the sum, minimum and maximum of the values of its sub-binary tree
+     * @details The nodes are allocated as AggregateNode from then on, and their summaries are maintained through
+     * insertions, deletions and the rotations and relinks of every balancing mode, the same way as the sizes of
+     * order statistics. RangeAggregate() then combines O(depth) summaries.
+     * @note Only an empty binary tree can be augmented, since its nodes are allocated with room for the summary.
+     * The summaries are dropped as soon as a level-order insertion breaks the binary search tree property, and
+     * concurrent insertions are refused while they are kept. Union() and Intersection() keep the value of either
+     * node of a data present in both binary trees.
+     * @see DisableRangeAggregates() for dropping the summaries
+     */
+    void EnableRangeAggregates();
+
+    /**
+     * @brief Stops maintaining the summaries of the sub-binary trees
+     * @note The nodes already allocated stay AggregateNode objects, new nodes are plain ones.
+     */
+    void DisableRangeAggregates();
+
+    /**
+     * @brief Sets the value carried by the node with the given data
+     * @details Descends to the node and recomputes the summaries of the node and of its ancestors.
+     * @param[in] inData Data of the node
+     * @param[in] inValue Value carried by the node
+     * @return True if the node is found and range aggregates are enabled, false otherwise
+     */
+    bool SetValue(int inData,
+                  int inValue);
+
+    /**
+     * @brief Aggregates the values of the nodes within a closed interval of data
+     * @details Descends to the node where the paths towards both ends of the interval part, then follows each
+     * path, adding the summary of every sub-binary tree lying wholly within the interval next to it. Each node
+     * adds its value once, whatever its count of occurrences.
+     * @param[in] inLowData Smallest data of the interval
+     * @param[in] inHighData Largest data of the interval
+     * @param[out] onSum Sum of the values
+     * @param[out] onMin Smallest value
+     * @param[out] onMax Largest value
+     * @return True if a node lies within the interval and range aggregates are enabled, false otherwise
+     */
+    bool RangeAggregate(int inLowData,
+                        int inHighData,
+                        long long &onSum,
+                        int &onMin,
+                        int &onMax);
+
     /**
      * @brief Searches for the node with the given data from the root node
+     * @details A binary search tree is searched by a descent of O(depth), any other binary tree is searched
+     * depth-first. While the data lies in a dense range the dense key bitmap answers with a single bit test,
+     * otherwise the radix index answers if it is enabled.
      * @param[in] inData Data to search for
-     * @return Distance from the given node, if found. Otherwise -1
+     * @return True if the data is found, false otherwise
+     * @note A complete binary tree without node index is walked with acquire loads of the links, so the search
+     * may run while other threads call ConcurrentInsertNodeInBinaryTree(). A node being linked meanwhile is
+     * either found or missed, never seen partially constructed.
      */
     bool SearchInBinaryTree(int inData);
 
+    /**
+     * @brief Searches for a batch of data at once
+     * @details On a binary search tree the descents of several data advance in lock-step, one level each per
+     * round, and the next node of each descent is prefetched before the other descents are advanced. The
+     * cache misses of the batch thus overlap instead of stalling one search after the other. Any other binary
+     * tree is walked once for the whole batch, unless the hash index answers directly.
+     * @param[in] ivData Data to search for
+     * @param[out] ovFound For each data, true if the data is found, false otherwise
+     */
+    void SearchInBinaryTree(const std::vector<int> &ivData,
+                            std::vector<bool> &ovFound);
+
+    /**
+     * @brief Counts the distinct data less than the given data
+     * @details While the data lies in a dense range, the dense key bitmap answers with popcounts. Otherwise the
+     * binary tree is walked, pruned to the nodes less than the data if it is a binary search tree.
+     * @param[in] inData Data to compare with
+     * @return Number of distinct data less than the given data
+     */
+    int CountDistinctDataLessThan(int inData);
+
+    /**
+     * @brief Counts the data less than the given data, every occurrence counted
+     * @details Descends towards the data, adding up the sizes of the sub-binary trees left behind on the left.
+     * @param[in] inData Data to compare with
+     * @return Number of data less than the given data, -1 unless order statistics are enabled
+     */
+    int Rank(int inData);
+
+    /**
+     * @brief Retrieves the data preceded by the given number of data in sorted order
+     * @details Descends by comparing the rank with the size of the left sub-binary tree at each node.
+     * @param[in] inRank Number of data before the wanted one, 0 for the smallest data
+     * @param[out] onData Data found
+     * @return True if the rank lies within the binary tree and order statistics are enabled, false otherwise
+     */
+    bool Select(int inRank,
+                int &onData);
+
+    /**
+     * @brief Retrieves the k-th smallest data
+     * @param[in] inK Position counted from the smallest data, 1 for the smallest data
+     * @param[out] onData Data found
+     * @return True if the position lies within the binary tree and order statistics are enabled, false otherwise
+     */
+    bool KthSmallest(int inK,
+                     int &onData);
+
+    /**
+     * @brief Retrieves the k-th largest data
+     * @param[in] inK Position counted from the largest data, 1 for the largest data
+     * @param[out] onData Data found
+     * @return True if the position lies within the binary tree and order statistics are enabled, false otherwise
+     */
+    bool KthLargest(int inK,
+                    int &onData);
+
+    /**
+     * @brief Counts the data of the binary tree, every occurrence counted
+     * @details Reads the size of the root node while order statistics are enabled, and the node count unless
+     * duplicates are counted in their node. Otherwise the nodes are walked.
+     * @return Number of data
+     */
+    int CountOfData();
+
+    /**
+     * @brief Retrieves the data within a closed interval in sorted order
+     * @details A binary search tree is walked in-order with an explicit stack that never enters a left
+     * sub-binary tree of a node below the interval and stops at the first node above it, so only the O(depth)
+     * nodes bordering the interval are visited besides the data retrieved. Any other binary tree is walked
+     * whole and the data found is sorted.
+     * @param[in] inLowData Smallest data of the interval
+     * @param[in] inHighData Largest data of the interval
+     * @param[in, out] iovData Vector the data within the interval is appended to
+     * @param[in] ibExpandDuplicates True to add the data of a node once per occurrence
+     */
+    void RangeQuery(int inLowData,
+                    int inHighData,
+                    std::vector<int> &iovData,
+                    bool ibExpandDuplicates = true);
+
+    /**
+     * @brief Counts the data within a closed interval, every occurrence counted
+     * @details While order statistics are enabled the count is the difference of two ranks, each a single
+     * descent. Otherwise the nodes within the interval are walked as by RangeQuery().
+     * @param[in] inLowData Smallest data of the interval
+     * @param[in] inHighData Largest data of the interval
+     * @return Number of data within the interval
+     */
+    int RangeCount(int inLowData,
+                   int inHighData);
+
+    /**
+     * @brief Finds the largest data which is not greater than the given data
+     * @details A binary search tree is descended once, keeping the last node passed on the wanted side, in
+     * O(depth). Any other binary tree is walked whole.
+     * @param[in] inData Data to compare with
+     * @param[out] onData Found data
+     * @return True if such a data exists, false otherwise
+     * @see BinaryTreeCursor for stepping through the data in sorted order
+     */
+    bool Floor(int inData,
+               int &onData);
+
+    /**
+     * @brief Finds the smallest data which is not less than the given data
+     * @details Searched the same way as by Floor().
+     * @param[in] inData Data to compare with
+     * @param[out] onData Found data
+     * @return True if such a data exists, false otherwise
+     */
+    bool Ceiling(int inData,
+                 int &onData);
+
+    /**
+     * @brief Finds the largest data which is less than the given data
+     * @details Searched the same way as by Floor(). The given data need not be present.
+     * @param[in] inData Data to compare with
+     * @param[out] onData Found data
+     * @return True if such a data exists, false otherwise
+     */
+    bool Predecessor(int inData,
+                     int &onData);
+
+    /**
+     * @brief Finds the smallest data which is greater than the given data
+     * @details Searched the same way as by Floor(). The given data need not be present.
+     * @param[in] inData Data to compare with
+     * @param[out] onData Found data
+     * @return True if such a data exists, false otherwise
+     */
+    bool Successor(int inData,
+                   int &onData);
+
     /**
      * @brief Performs an pre-order traversal of the binary tree
      * @details Prints all nodes in the binary tree in pre-order sequence.
@@ -90,8 +609,19 @@ public:
     /**
      * @brief Performs and in-order traversal of the binary tree
      * @details Prints all nodes in the binary tree in in-order sequence.
+     * A node holding several occurrences of its data is printed once as data'x'count, unless expanded.
+     * @param[in] ibExpandDuplicates True to print the data of a node once per occurrence
+     */
+    void InOrderTraversal(bool ibExpandDuplicates = false);
+
+    /**
+     * @brief Retrieves the data of all nodes in in-order sequence
+     * @details For a binary search tree the data is sorted.
+     * @param[in, out] iovData Vector the data of the nodes is appended to
+     * @param[in] ibExpandDuplicates True to add the data of a node once per occurrence
      */
-    void InOrderTraversal();
+    void RetrieveInOrderData(std::vector<int> &iovData,
+                             bool ibExpandDuplicates = true);
 
     /**
      * @brief Performs a post-order traversal of the binary tree
@@ -181,10 +711,21 @@ public:
     /**
      * @brief Returns the height of the binary tree
      * @details The height of a binary tree is the number of edges on the longest path between the root node and a leaf node.
+     * It takes O(1) for a complete binary tree, from its node count, and while subtree heights are enabled.
      * @return Height of the binary tree
      */
     int HeightOfBinaryTree();
 
+    /**
+     * @brief Returns the height of the sub-binary tree of the node with the given data
+     * @details Locates the node as FindLevelOfNode() does, then reads its height while subtree heights are enabled.
+     * In a complete binary tree the height follows from the depth and the level-order position of the node in
+     * O(1) while the node index is enabled, and from its leftmost path in O(log n) otherwise.
+     * @param[in] inData Data of the node
+     * @return Height of the sub-binary tree, -1 if the data is not found
+     */
+    int HeightOfNode(int inData);
+
     /**
      * @brief Returns the level of node in the binary tree
      * @details Level of the node in binary tree is the number of nodes required to traverse from root node
@@ -193,6 +734,33 @@ public:
     int FindLevelOfNode(int inData);
 
 private:
+    /**
+     * @brief Copies the shape of the binary tree from its root node
+     */
+    friend class VanEmdeBoasSnapshot;
+
+    /**
+     * @brief Walks the nodes of the binary tree from its root node
+     */
+    friend class BinaryTreeCursor;
+
+    /**
+     * @struct FingerRange
+     * @brief Range of data the sub-binary tree of a node on the finger path may hold
+     */
+    struct FingerRange
+    {
+        /**
+         * @brief Smallest data the sub-binary tree may hold (inclusive)
+         */
+        long long nLowerBound;
+
+        /**
+         * @brief Largest data the sub-binary tree may hold (exclusive)
+         */
+        long long nUpperBound;
+    };
+
     /**
      * @brief Constructor for BinaryTree
      */
@@ -203,22 +771,428 @@ private:
      */
     virtual ~BinaryTree();
 
+    /**
+     * @brief Creates the binary tree from a pre-order or post-order sequence and the in-order sequence
+     * @param[in] ivOrder Data of the binary tree in pre-order or post-order sequence
+     * @param[in] ivInOrder Data of the binary tree in in-order sequence
+     * @param[in] ibPostOrder True if ivOrder is the post-order sequence
+     * @return Pointer of created binary tree object. Otherwise nullptr.
+     */
+    static BinaryTree *CreateBinaryTreeFromTraversals(const std::vector<int> &ivOrder,
+                                                      const std::vector<int> &ivInOrder,
+                                                      bool ibPostOrder);
+
+    /**
+     * @brief Builds a balanced sub-binary search tree from the next data of a sorted stream
+     * @param[in, out] ioStream Stream of data in non-decreasing order
+     * @param[in] inCount Number of data to read for the sub-binary tree
+     * @param[in, out] ionPreviousData Data read last, to check the order of the stream
+     * @param[in, out] iobValid Set to false once the stream ends early or is not sorted
+     * @return Root node of the sub-binary tree. nullptr if it is empty or the stream is not valid.
+     */
+    Node *BuildBalancedSubBinaryTree(std::istream &ioStream,
+                                     int inCount,
+                                     long long &ionPreviousData,
+                                     bool &iobValid);
+
     /**
      * @brief Removes all children of a given node
+     * @details The two sub-binary trees of a node are removed by two threads down to the given depth. Below it
+     * each sub-binary tree is removed by one thread with an explicit stack, so neither the number of threads
+     * nor the recursion grows with the size of the binary tree.
      * @param[in] ipParentNode Parent node whose children are to be removed
+     * @param[in] inParallelDepth Number of levels below which no further thread is started
+     */
+    void RemoveChildren(Node *ipParentNode,
+                        int inParallelDepth = 0);
+
+    /**
+     * @brief Links a node at the given slot of the complete binary tree
+     * @param[in] ipNewNode Node to link
+     * @param[in] inSlot Level-order index of the slot, 0 being the root node
+     * @return Parent node of the slot, nullptr for the root node
+     */
+    Node *LinkNodeAtSlot(Node *ipNewNode,
+                         int inSlot);
+
+    /**
+     * @brief Retrieves the node at the given slot of the complete binary tree
+     * @details The path to the slot is given by the bits of its 1-based level-order position below the
+     * leading bit, 0 for left and 1 for right. Spin-waits, yielding, for every node on the path that is not
+     * linked yet.
+     * @param[in] inSlot Level-order index of the slot, 0 being the root node
+     * @return Node at the slot
+     */
+    Node *RetrieveNodeAtSlot(int inSlot);
+
+    /**
+     * @brief Searches a complete binary tree depth-first, loading every link with acquire ordering
+     * @param[in] inData Data to search for
+     * @return Pointer to a node holding the data, nullptr if none is linked yet
+     * @note Slots claimed but not linked yet are skipped instead of waited for.
+     */
+    Node *SearchInCompleteBinaryTree(int inData);
+
+    /**
+     * @brief Replaces a child of the given parent node
+     * @param[in] ipParentNode Parent node, nullptr to replace the root node
+     * @param[in] ipOldNode Child node to replace
+     * @param[in] ipNewNode Node to link instead
+     */
+    void ReplaceChild(Node *ipParentNode,
+                      Node *ipOldNode,
+                      Node *ipNewNode);
+
+    /**
+     * @brief Unlinks a node from the binary search tree
+     * @param[in] ipNode Node to unlink
+     * @param[in] ipParentNode Parent of the node, nullptr for the root node
+     */
+    void RemoveNodeFromBinarySearchTree(Node *ipNode,
+                                        Node *ipParentNode);
+
+    /**
+     * @brief Rotates a child of the given node up into its place
+     * @param[in] ipParentNode Parent of the node, nullptr for the root node
+     * @param[in] ipNode Node to rotate down
+     * @param[in] ibRight False to rotate the left child up, true to rotate the right child up
+     * @return Child which took the place of the node
+     */
+    Node *RotateChildUp(Node *ipParentNode,
+                        Node *ipNode,
+                        bool ibRight);
+
+    /**
+     * @brief Splays the node reached by a search for the given data to the root of a sub-binary search tree
+     * @details Top-down splay: the nodes passed on the way down are hung off a left and a right tree, a zig-zig
+     * step rotating first, and both trees are reassembled below the last node reached. Needs no path.
+     * @param[in] ipRootNode Root of the sub-binary search tree
+     * @param[in] inData Data to search for
+     * @return New root of the sub-binary search tree, holding the data if present, otherwise its predecessor
+     * or successor
+     */
+    Node *SplayBinarySearchTree(Node *ipRootNode,
+                                int inData);
+
+    /**
+     * @brief Rebuilds a sub-binary search tree in perfect balance with Day-Stout-Warren rotations
+     * @details Right rotations first straighten the sub-binary tree into a vine of right children, then
+     * rounds of left rotations along the vine fold it into a tree whose levels are all full but the last.
+     * Nodes are relinked in place, so only a header node on the stack is needed.
+     * @param[in] ipRootNode Root of the sub-binary search tree
+     * @return New root of the sub-binary search tree
+     */
+    Node *RebuildSubBinarySearchTree(Node *ipRootNode);
+
+    /**
+     * @brief Rebuilds the sub-binary tree of the scapegoat of a node inserted too deep
+     * @param[in] ipNode Node inserted last
+     * @param[in] ivPath Ancestors of the node, the root node first
+     */
+    void RebuildAtScapegoat(Node *ipNode,
+                            const std::vector<Node *> &ivPath);
+
+    /**
+     * @brief Returns the treap priority of a data
+     * @param[in] inData Data of the node
+     * @return Priority of the node, a node of higher priority lies closer to the root node
+     */
+    static std::uint64_t TreapPriority(int inData);
+
+    /**
+     * @brief Rotates a newly linked leaf of the treap up past its ancestors of lower priority
+     * @param[in] ipNode Node linked last
+     * @param[in] ivPath Ancestors of the node, the root node first
+     * @param[out] onIntactCount Number of nodes at the front of the path left in place, which are still the
+     * ancestors of the node
+     */
+    void RebalanceAfterTreapInsertion(Node *ipNode,
+                                      const std::vector<Node *> &ivPath,
+                                      int &onIntactCount);
+
+    /**
+     * @brief Splits a sub-binary search tree into the nodes below and above the given data
+     * @details Relinks the nodes of the search path only, so a treap splits into two treaps.
+     * @param[in] ipRootNode Root of the sub-binary search tree
+     * @param[in] inData Data to split at
+     * @param[in] ibEqualToLeft True to put the nodes holding the data into the left part, false for the right
+     * @param[out] opLeftNode Root of the part of the smaller data
+     * @param[out] opRightNode Root of the part of the larger data
      */
-    void RemoveChildren(Node *ipParentNode);
+    void SplitSubBinarySearchTree(Node *ipRootNode,
+                                  int inData,
+                                  bool ibEqualToLeft,
+                                  Node *&opLeftNode,
+                                  Node *&opRightNode);
+
+    /**
+     * @brief Joins two treaps, the data of the first all not greater than the data of the second
+     * @param[in] ipLeftNode Root of the treap of the smaller data
+     * @param[in] ipRightNode Root of the treap of the larger data
+     * @return Root of the joined treap
+     */
+    Node *JoinTreap(Node *ipLeftNode,
+                    Node *ipRightNode);
+
+    /**
+     * @brief Joins two sub-binary search trees below the smallest node of the second one
+     * @param[in] ipLeftNode Root of the sub-binary search tree of the smaller data
+     * @param[in] ipRightNode Root of the sub-binary search tree of the larger data, not empty
+     * @return Root of the joined sub-binary search tree
+     */
+    Node *JoinSubBinarySearchTrees(Node *ipLeftNode,
+                                   Node *ipRightNode);
+
+    /**
+     * @brief Splits a red-black tree into the red-black trees of the nodes below and above the given data
+     * @param[in] ipRootNode Root of the red-black tree
+     * @param[in] inData Data to split at, the nodes holding it go to the right part
+     * @param[out] opLeftNode Root of the red-black tree of the smaller data
+     * @param[out] opRightNode Root of the red-black tree of the larger data
+     * @note The root node of the binary tree is used as scratch and must be set afterwards.
+     */
+    void SplitRedBlackTree(Node *ipRootNode,
+                           int inData,
+                           Node *&opLeftNode,
+                           Node *&opRightNode);
+
+    /**
+     * @brief Joins two red-black trees and a middle node lying between their data
+     * @details Takes O(1 + difference of the black heights).
+     * @param[in] ipLeftNode Root of the red-black tree of the smaller data, its colour ignored
+     * @param[in] inLeftBlackHeight Black height of the left red-black tree with a black root node
+     * @param[in] ipMiddleNode Node without children
+     * @param[in] ipRightNode Root of the red-black tree of the larger data, its colour ignored
+     * @param[in] inRightBlackHeight Black height of the right red-black tree with a black root node
+     * @param[out] onBlackHeight Black height of the joined red-black tree
+     * @return Root of the joined red-black tree
+     * @note The root node of the binary tree is used as scratch and must be set afterwards.
+     */
+    Node *JoinRedBlackTrees(Node *ipLeftNode,
+                            int inLeftBlackHeight,
+                            Node *ipMiddleNode,
+                            Node *ipRightNode,
+                            int inRightBlackHeight,
+                            int &onBlackHeight);
+
+    /**
+     * @brief Unlinks the node of the smallest data from the red-black tree
+     * @return Unlinked node, without children
+     * @note The binary tree must not be empty. The node count is left unchanged.
+     */
+    Node *DetachSmallestRedBlackNode();
+
+    /**
+     * @brief Returns the number of black nodes on a path from a node down to an empty child
+     * @param[in] ipNode Root of the red-black tree
+     * @return Black height, the root node counted if black, 0 for an empty red-black tree
+     */
+    static int RetrieveBlackHeight(const Node *ipNode);
+
+    /**
+     * @brief Unites two treaps
+     * @param[in] ipFirstNode Root of the first treap
+     * @param[in] ipSecondNode Root of the second treap
+     * @param[in] inParallelDepth Number of levels below which no further task is forked
+     * @param[out] onRemovedCount Number of nodes freed
+     * @return Root of the united treap
+     */
+    Node *UnionTreaps(Node *ipFirstNode,
+                      Node *ipSecondNode,
+                      int inParallelDepth,
+                      int &onRemovedCount);
+
+    /**
+     * @brief Intersects two treaps
+     * @param[in] ipFirstNode Root of the first treap
+     * @param[in] ipSecondNode Root of the second treap
+     * @param[in] inParallelDepth Number of levels below which no further task is forked
+     * @param[out] onRemovedCount Number of nodes freed
+     * @return Root of the intersected treap
+     */
+    Node *IntersectTreaps(Node *ipFirstNode,
+                          Node *ipSecondNode,
+                          int inParallelDepth,
+                          int &onRemovedCount);
+
+    /**
+     * @brief Removes the data of the second treap from the first
+     * @param[in] ipFirstNode Root of the treap to remove from
+     * @param[in] ipSecondNode Root of the treap of the data to remove
+     * @param[in] inParallelDepth Number of levels below which no further task is forked
+     * @param[out] onRemovedCount Number of nodes freed
+     * @return Root of the remaining treap
+     */
+    Node *SubtractTreaps(Node *ipFirstNode,
+                         Node *ipSecondNode,
+                         int inParallelDepth,
+                         int &onRemovedCount);
+
+    /**
+     * @brief Frees a sub-binary tree
+     * @param[in] ipNode Root of the sub-binary tree
+     * @return Number of nodes freed
+     */
+    int FreeSubBinaryTree(Node *ipNode);
+
+    /**
+     * @brief Checks that another binary tree can take part in a treap operation with this one
+     * @param[in] ipBinaryTree Other binary tree
+     * @return True if both binary trees are distinct treaps, false otherwise
+     */
+    bool IsTreapOperand(const BinaryTree *ipBinaryTree) const;
+
+    /**
+     * @brief Returns the number of levels of a treap operation that fork a task of the fork-join pool
+     * @param[in] inNodeCount Number of nodes of both treaps
+     * @return log2 of the hardware threads, fewer when halving the nodes that often leaves less than
+     * _nParallelGrainSize nodes per task
+     * @note Each level halves the nodes in expectation, since the priorities of a treap are random.
+     */
+    int RetrieveParallelDepth(int inNodeCount) const;
+
+    /**
+     * @brief Checks whether a treap operation forks the work on the left sub-binary trees
+     * @param[in] ipFirstNode Left sub-binary tree of the first treap
+     * @param[in] ipSecondNode Left part of the second treap
+     * @param[in] inParallelDepth Number of levels left that may fork
+     * @return True if levels are left and, while subtree sizes are enabled, both hold at least
+     * _nParallelGrainSize occurrences together
+     * @note It is a constant member function.
+     */
+    bool IsWorthForking(const Node *ipFirstNode,
+                        const Node *ipSecondNode,
+                        int inParallelDepth) const;
+
+    /**
+     * @brief Checks that the nodes of another binary tree can be linked into this one
+     * @details Enables the order statistics and subtree heights of the other binary tree if this one keeps them.
+     * @param[in] ipBinaryTree Other binary tree
+     * @return True if both binary trees are distinct binary search trees in the same balancing mode, and the
+     * other one carries range aggregates if this one does, false otherwise
+     */
+    bool IsCompatibleOperand(const BinaryTree *ipBinaryTree) const;
+
+    /**
+     * @brief Takes over the nodes of another binary tree and deletes it
+     * @param[in] ipRootNode New root node
+     * @param[in] inNodeCount New number of nodes
+     * @param[in, out] iopBinaryTree Binary tree whose nodes were moved. Deleted and set to nullptr.
+     */
+    void AdoptBinaryTree(Node *ipRootNode,
+                         int inNodeCount,
+                         BinaryTree *&iopBinaryTree);
+
+    /**
+     * @brief Rebuilds the state derived from the nodes after they were relinked in bulk
+     * @note It takes O(depth) unless a Bloom filter, a radix index or a dense key bitmap has to be refilled,
+     * which takes time linear in the number of nodes.
+     */
+    void ResetDerivedState();
+
+    /**
+     * @brief Colours a newly linked node red and restores the red-black properties up its path
+     * @param[in] ipNode Node linked last
+     * @param[in] ivPath Ancestors of the node, the root node first
+     * @param[out] onIntactCount Number of nodes at the front of the path left in place, which are still the
+     * ancestors of the node
+     * @return True if the red was pushed up to the root node, whose recolouring adds a level of black nodes
+     */
+    bool RebalanceAfterRedBlackInsertion(Node *ipNode,
+                                         const std::vector<Node *> &ivPath,
+                                         int &onIntactCount);
+
+    /**
+     * @brief Unlinks a node from the red-black tree and restores the red-black properties up its path
+     * @details A node with two children first swaps its place and colour with its in-order successor, so
+     * the node unlinked always has at most one child. Nodes move, their data is never copied.
+     * @param[in] ipNode Node to unlink
+     * @param[in, out] iovPath Ancestors of the node, the root node first. Used as scratch space.
+     */
+    void RemoveNodeFromRedBlackTree(Node *ipNode,
+                                    std::vector<Node *> &iovPath);
+
+    /**
+     * @brief Unlinks a node from the binary tree by moving the last node in level order to its place
+     * @param[in] ipNode Node to unlink
+     * @param[in] ipParentNode Parent of the node, nullptr for the root node
+     * @param[in] inDepth Depth of the node
+     */
+    void RemoveNodeFromBinaryTree(Node *ipNode,
+                                  Node *ipParentNode,
+                                  int inDepth);
+
+    /**
+     * @brief Marks the binary tree as not complete and drops the state which relies on it
+     */
+    void InvalidateCompleteTree();
+
+    /**
+     * @brief Adds the data of a newly linked node to the auxiliary filters and indexes
+     * @param[in] ipNode Node linked into the binary tree
+     */
+    void NotifyNodeInserted(Node *ipNode);
+
+    /**
+     * @brief Removes a deleted data from the auxiliary indexes unless another node still holds it
+     * @param[in] inData Data of the node removed from the binary tree
+     * @param[in] ipNode Node unlinked from the binary tree, not freed yet
+     */
+    void NotifyDataRemoved(int inData,
+                           const Node *ipNode);
+
+    /**
+     * @brief Recomputes the range of the data and builds the dense key bitmap if the range is dense
+     * @details A range is dense while it spans at most 64 integers per node, so that the bitmap takes at most
+     * 8 bytes per node. The bitmap gets a quarter of the range as slack on either side so that data growing
+     * the range rebuilds it only every so often. A sparse range drops the bitmap.
+     */
+    void RebuildDenseKeyBitmap();
+
+    /**
+     * @brief Recomputes the range of the data from the leftmost and the rightmost node of a binary search tree
+     * @note It takes O(depth), the root node must not be null.
+     */
+    void UpdateDataRange();
+
+    /**
+     * @brief Finds the node with the given data along with its parent node and depth
+     * @details Uses the hash index if enabled, otherwise searches the binary tree.
+     * @param[in] inData Data to search for
+     * @param[out] opParentNode Parent of the node, nullptr for the root node
+     * @param[out] onDepth Depth of the node
+     * @return Pointer of node. Otherwise nullptr.
+     */
+    Node *LocateNode(int inData,
+                     Node *&opParentNode,
+                     int &onDepth);
 
     /**
      * @brief Finds the node with the given data
+     * @details If the binary tree is ordered, the search descends along the only path which may hold the data
+     * in O(depth). Otherwise the sub-binary tree is searched depth-first, left before right, keeping the
+     * path to the current node on an explicit stack.
      * @param[in] ipRootNode Root node of sub-binary tree
-     * @param[in] inData Data to be searchedin the binary tree
-     * @param[in, out] iodqNodes Dequeue to store all the nodes while traversing to the node
+     * @param[in] inData Data to be searched in the binary tree
+     * @param[out] ovPath Ancestors of the found node, from the root node to its parent
      * @return Pointer of node. Otherwise nullptr.
      */
     Node *SearchInBinaryTree(Node *ipRootNode,
                              int inData,
-                             std::deque<Node *> &iodqNodes);
+                             std::vector<Node *> &ovPath);
+
+    /**
+     * @brief Finds the node with the given data by descending the binary search tree from the root node
+     * @details Unlike SearchInBinaryTree() no path is collected, only the parent and the depth of the node.
+     * @param[in] inData Data to be searched in the binary search tree
+     * @param[out] opParentNode Parent of the found node, nullptr for the root node
+     * @param[out] onDepth Depth of the found node
+     * @return Pointer of node. Otherwise nullptr.
+     * @see SetBranchlessSearch() for the selection of the kernel
+     */
+    Node *DescendBinarySearchTree(int inData,
+                                  Node *&opParentNode,
+                                  int &onDepth);
 
     /**
      * @brief Performs an pre-order traversal of the binary tree node
@@ -333,31 +1307,130 @@ private:
                                      std::vector<Node *> &iovNodes);
 
     /**
-     * @brief Retrieves sibling node of a given data
-     * @param[in] ipNode Node to traverse
-     * @param[in] inData Data of a node whose cousins are to be printed
-     * @return True if sibling is found, false otherwise
+     * @brief Returns the height of sub binary tree having root node as given node
+     * @details The height of a given binary tree node is the number of edges on the longest path between the given node and a leaf node.
+     * It is read from the node while subtree heights are enabled.
+     * @param[in] ipNode Node whose height is to be calculated
+     * @return Height of the binary tree
      */
-    Node *RetrieveSibling(Node *ipNode,
-                          int inData);
+    int HeightOfSubBinaryTree(Node *ipNode);
 
     /**
-     * @brief Retrieves all cousin nodes of a given data
-     * @param[in] ipRootNode Root node of the binary tree
-     * @param[in] inData Data of a node whose cousins are to be printed
-     * @param[out] ovNodes Vector containing list of pointers of ouput nodes
+     * @brief Counts the data less than, or not greater than, the given data from the sizes of the nodes
+     * @param[in] inData Data to compare with
+     * @param[in] ibInclusive True to also count the occurrences of the data itself
+     * @return Number of data before the given data
      */
-    void RetrieveCousins(Node *ipRootNode,
-                         int inData,
-                         std::vector<Node *> &ovNodes);
+    int RankOfData(int inData,
+                   bool ibInclusive);
 
     /**
-     * @brief Returns the height of sub binary tree having root node as given node
-     * @details The height of a given binary tree node is the number of edges on the longest path between the given node and a leaf node.
-     * @param[in] ipNode Node whose height is to be calculated
-     * @return Height of the binary tree
+     * @brief Retrieves the nodes within a closed interval in in-order sequence
+     * @param[in] inLowData Smallest data of the interval
+     * @param[in] inHighData Largest data of the interval
+     * @param[out] ovNodes Nodes within the interval
      */
-    int HeightOfSubBinaryTree(Node *ipNode);
+    void RetrieveRangeNodes(int inLowData,
+                            int inHighData,
+                            std::vector<Node *> &ovNodes);
+
+    /**
+     * @brief Finds the closest data on one side of the given data
+     * @param[in] inData Data to compare with
+     * @param[in] ibLarger True for the closest larger data, false for the closest smaller data
+     * @param[in] ibInclusive True if the given data itself qualifies
+     * @param[out] onData Found data
+     * @return True if such a data exists, false otherwise
+     */
+    bool RetrieveNeighbourData(int inData,
+                               bool ibLarger,
+                               bool ibInclusive,
+                               int &onData);
+
+    /**
+     * @brief Returns the number of occurrences kept in a node for its sub-binary tree
+     * @param[in] ipNode Root of the sub-binary tree
+     * @return Size of the sub-binary tree, 0 for an empty one
+     */
+    static int RetrieveSubtreeSize(const Node *ipNode);
+
+    /**
+     * @brief Returns the height kept in a node for its sub-binary tree
+     * @param[in] ipNode Root of the sub-binary tree
+     * @return Height of the sub-binary tree, -1 for an empty one
+     */
+    static int RetrieveSubtreeHeight(const Node *ipNode);
+
+    /**
+     * @brief Checks whether the nodes keep anything about their sub-binary trees
+     * @return True if order statistics, range aggregates or subtree heights are enabled, false otherwise
+     * @note It is a constant member function.
+     */
+    bool IsAugmented() const;
+
+    /**
+     * @brief Allocates a node of the kind the binary tree holds
+     * @param[in] inData Data element to store in the node
+     * @return Pointer of created node object, an AggregateNode while range aggregates are enabled and an
+     * AugmentedNode while only order statistics or subtree heights are
+     */
+    Node *CreateNode(int inData);
+
+    /**
+     * @brief Replaces every node by an AugmentedNode holding the same data, count and colour
+     * @note The finger path is dropped, and the node index and the radix index are rebuilt over the new nodes.
+     */
+    void AugmentNodes();
+
+    /**
+     * @brief Recomputes the size, the summary and the height of a node from its own data and those of its children
+     * @param[in] ipNode Node whose children or occurrences changed
+     * @note Only the augmentations enabled are recomputed.
+     */
+    void UpdateAugmentation(Node *ipNode);
+
+    /**
+     * @brief Recomputes the augmentations of changed nodes, the last one first
+     * @param[in] ivNodes Changed nodes, each one before the changed nodes below it
+     * @note Does nothing unless the binary tree is augmented.
+     */
+    void UpdateAugmentations(const std::vector<Node *> &ivNodes);
+
+    /**
+     * @brief Recomputes the augmentations of the nodes of the finger path, the deepest one first
+     * @note Does nothing unless the binary tree is augmented.
+     */
+    void UpdateFingerPathAugmentations();
+
+    /**
+     * @brief Extends the finger path by a child of its last node, narrowing the range of data on its side
+     * @param[in] ipChildNode Left or right child of the last node of the finger path
+     */
+    void DescendFingerPath(Node *ipChildNode);
+
+    /**
+     * @brief Drops the finger path, the next finger insertion starts from the root node
+     */
+    void ClearFingerPath();
+
+    /**
+     * @brief Returns the number of nodes of sub binary tree having root node as given node
+     * @param[in] ipNode Root of the sub binary tree
+     * @return Number of nodes, duplicates counted in a node count once
+     */
+    int CountNodesOfSubBinaryTree(Node *ipNode);
+
+    /**
+     * @brief Returns the number of nodes of the first of two sub binary trees holding a known number of nodes
+     * @details Walks both sub binary trees one node each in turn, so it takes time linear in the smaller one.
+     * @param[in] ipFirstNode Root of the sub binary tree to count
+     * @param[in] ipSecondNode Root of the other sub binary tree
+     * @param[in] inNodeCount Number of nodes of both sub binary trees
+     * @return Number of nodes of the first sub binary tree, duplicates counted in a node count once
+     */
+    static int CountNodesOfFirstSubBinaryTree(Node *ipFirstNode,
+                                              Node *ipSecondNode,
+                                              int inNodeCount);
 
     /**
      * @brief Represents the root node of the binary tree
@@ -366,4 +1439,113 @@ private:
      * It is the topmost node in the tree.
      */
     Node *_pRootNode;
+
+    /**
+     * @brief Smallest number of nodes a treap operation hands to a task of its own
+     */
+    static constexpr int _nParallelGrainSize = 4096;
+
+    /**
+     * @brief Number of nodes in the binary tree
+     * @details For a complete binary tree it is also the slot index of the next node.
+     */
+    std::atomic<int> _nNodeCount;
+
+    /**
+     * @brief True while the binary tree is known to be a complete binary tree
+     */
+    bool _bCompleteTree;
+
+    /**
+     * @brief True while the binary tree is known to hold the binary search tree property
+     * @details Set as long as the data is inserted by InsertNodeInBinarySearchTree() or built from a sorted
+     * sequence. Any other insertion into a non-empty binary tree clears it.
+     */
+    bool _bOrderedTree;
+
+    /**
+     * @brief Path from the root node to the node inserted last by InsertNodeInBinarySearchTreeFromFinger()
+     * @note Kept apart from the ranges so that the rebalancing can walk it as any other path.
+     */
+    std::vector<Node *> _vFingerPath;
+
+    /**
+     * @brief Range of data of each node of the finger path
+     */
+    std::vector<FingerRange> _vFingerRanges;
+
+    /**
+     * @brief True if duplicates are counted in their node instead of inserted as new nodes
+     */
+    bool _bMultiset;
+
+    /**
+     * @brief Hash index from data to node, nullptr unless enabled
+     */
+    NodeIndex *_pNodeIndex;
+
+    /**
+     * @brief Bloom filter answering negative searches, nullptr unless enabled
+     */
+    BloomFilter *_pBloomFilter;
+
+    /**
+     * @brief True if ordered searches use the branchless kernel
+     */
+    bool _bBranchlessSearch;
+
+    /**
+     * @brief Bitmap over the range of the data, nullptr unless the range is dense
+     */
+    DenseKeyBitmap *_pDenseKeyBitmap;
+
+    /**
+     * @brief Smallest data inserted since the range was last recomputed
+     */
+    int _nMinData;
+
+    /**
+     * @brief Largest data inserted since the range was last recomputed
+     */
+    int _nMaxData;
+
+    /**
+     * @brief True if concurrent insertions may have left the range and the dense key bitmap incomplete
+     */
+    bool _bDenseKeysStale;
+
+    /**
+     * @brief Adaptive radix tree from data to node, nullptr unless enabled
+     */
+    AdaptiveRadixTree *_pRadixIndex;
+
+    /**
+     * @brief How the binary search tree bounds its depth
+     */
+    BalancingMode _eBalancingMode;
+
+    /**
+     * @brief Largest number of nodes since the scapegoat tree was last rebuilt as a whole
+     */
+    int _nMaxNodeCount;
+
+    /**
+     * @brief True while every node keeps the number of occurrences in its sub-binary tree
+     */
+    bool _bSubtreeSizes;
+
+    /**
+     * @brief True while every node is an AggregateNode keeping the summary of its sub-binary tree
+     */
+    bool _bRangeAggregates;
+
+    /**
+     * @brief True while every node keeps the height of its sub-binary tree
+     */
+    bool _bSubtreeHeights;
+
+    /**
+     * @brief True while every node is at least an AugmentedNode with room for its size and height
+     */
+    bool _bAugmentedNodes;
 };
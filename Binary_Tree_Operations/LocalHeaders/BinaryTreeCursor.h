@@ -0,0 +1,132 @@
+//-------------------------------------------------------------------
+/**
+ * @file BinaryTreeCursor.h
+ * @brief Header file for the BinaryTreeCursor class.
+ * @author Aditya Jedhe
+ * @date 2025-03-20
+ */
+//-------------------------------------------------------------------
+
+#ifndef _BINARYTREECURSOR_H_
+#define _BINARYTREECURSOR_H_
+
+// ---------------------------------------------- System Headers
+#include <vector>
+
+// ---------------------------------------------- Forward declaration
+class BinaryTree;
+class Node;
+
+//-------------------------------------------------------------------
+/**
+ * @class BinaryTreeCursor
+ * @brief Position in a binary search tree which steps to the next or the previous data in sorted order.
+ * @details The cursor keeps the path from the root node to its node, as the nodes have no link to their parent.
+ * A step descends into the sub-binary tree on its side or climbs to the first ancestor on that side, and every
+ * edge is crossed twice over a full walk, so a step takes O(1) amortised and O(depth) at worst. A node holding
+ * several occurrences of its data is a single position.
+ * @note Any insertion or deletion may move the nodes of the path; the cursor must be positioned again afterwards.
+ */
+class BinaryTreeCursor
+{
+public:
+    /**
+     * @brief Constructor for BinaryTreeCursor
+     * @details The cursor is not positioned until First(), Last() or Seek() is called.
+     * @param[in] ipBinaryTree Binary search tree to walk
+     */
+    BinaryTreeCursor(BinaryTree *ipBinaryTree);
+
+    /**
+     * @brief Destructor for BinaryTreeCursor
+     */
+    virtual ~BinaryTreeCursor();
+
+    /**
+     * @brief Positions the cursor at the smallest data
+     * @return True if the binary tree is a non-empty binary search tree, false otherwise
+     */
+    bool First();
+
+    /**
+     * @brief Positions the cursor at the largest data
+     * @return True if the binary tree is a non-empty binary search tree, false otherwise
+     */
+    bool Last();
+
+    /**
+     * @brief Positions the cursor at the smallest data which is not less than the given data
+     * @details Descends once from the root node, in O(depth), keeping the path up to the last node passed which
+     * is not less than the data.
+     * @param[in] inData Data to compare with
+     * @return True if such a data exists, false otherwise
+     */
+    bool Seek(int inData);
+
+    /**
+     * @brief Steps to the next larger data
+     * @return True if the cursor stays within the binary tree, false if it leaves it past the largest data
+     */
+    bool Next();
+
+    /**
+     * @brief Steps to the next smaller data
+     * @return True if the cursor stays within the binary tree, false if it leaves it past the smallest data
+     */
+    bool Previous();
+
+    /**
+     * @brief Checks whether the cursor is at a node
+     * @return True if the cursor is positioned, false otherwise
+     * @note It is a constant member function.
+     */
+    bool IsValid() const;
+
+    /**
+     * @brief Retrieves the data at the cursor
+     * @return Data of the node at the cursor
+     * @note It is a constant member function. The cursor must be valid.
+     */
+    int GetData() const;
+
+    /**
+     * @brief Retrieves the number of occurrences of the data at the cursor
+     * @return Count of the node at the cursor
+     * @note It is a constant member function. The cursor must be valid.
+     */
+    int GetCount() const;
+
+private:
+    /**
+     * @brief Checks that the binary tree can be walked in sorted order
+     * @return True if the binary tree holds the binary search tree property, false otherwise
+     */
+    bool IsOrderedTree() const;
+
+    /**
+     * @brief Descends from a node to the extreme node of its sub-binary tree, appending the path
+     * @param[in] ipNode Root of the sub-binary tree, nullptr for none
+     * @param[in] ibLargest True for the largest data, false for the smallest data
+     */
+    void DescendToExtreme(Node *ipNode,
+                          bool ibLargest);
+
+    /**
+     * @brief Steps to the neighbouring data on one side
+     * @param[in] ibForward True for the next larger data, false for the next smaller data
+     * @return True if the cursor stays within the binary tree, false otherwise
+     */
+    bool Step(bool ibForward);
+
+    /**
+     * @brief Binary tree walked
+     */
+    BinaryTree *_pBinaryTree;
+
+    /**
+     * @brief Nodes from the root node to the node at the cursor, empty if the cursor is not positioned
+     */
+    std::vector<Node *> _vPath;
+};
+
+#endif // _BINARYTREECURSOR_H_
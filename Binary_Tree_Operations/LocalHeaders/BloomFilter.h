@@ -0,0 +1,117 @@
+//-------------------------------------------------------------------
+/**
+ * @file BloomFilter.h
+ * @brief Header file for the BloomFilter class.
+ * @author Aditya Jedhe
+ * @date 2025-03-06
+ */
+//-------------------------------------------------------------------
+
+#ifndef _BLOOMFILTER_H_
+#define _BLOOMFILTER_H_
+
+// ---------------------------------------------- System Headers
+#include <cstdint>
+#include <vector>
+
+//-------------------------------------------------------------------
+/**
+ * @class BloomFilter
+ * @brief Blocked Bloom filter over integer data.
+ * @details All bits of a data are set within one 64-byte block, so a lookup reads a single cache line.
+ * The number of blocks and of bits per data are derived from the expected number of data and the
+ * requested false-positive rate.
+ * @note Data cannot be removed from the filter. After many deletions it should be rebuilt from the data
+ * still present.
+ */
+class BloomFilter
+{
+public:
+    /**
+     * @brief Constructor for BloomFilter
+     * @param[in] inExpectedCount Number of data the filter is sized for
+     * @param[in] idFalsePositiveRate Probability of reporting an absent data as possibly present
+     */
+    BloomFilter(int inExpectedCount,
+                double idFalsePositiveRate);
+
+    /**
+     * @brief Destructor for BloomFilter
+     */
+    virtual ~BloomFilter();
+
+    /**
+     * @brief Adds a data to the filter
+     * @param[in] inData Data to add
+     * @note The bits are set atomically, so several threads may add data at the same time.
+     */
+    void Insert(int inData);
+
+    /**
+     * @brief Checks if a data may be present
+     * @param[in] inData Data to check
+     * @return False if the data is definitely absent, true if it may be present
+     * @note The bits are loaded atomically, so a data may be checked while other threads add data.
+     */
+    bool MayContain(int inData) const;
+
+    /**
+     * @brief Removes all data and resizes the filter
+     * @param[in] inExpectedCount Number of data the filter is sized for
+     */
+    void Reset(int inExpectedCount);
+
+    /**
+     * @brief Returns the number of data the filter is sized for
+     * @return Expected number of data
+     */
+    int Capacity() const;
+
+    /**
+     * @brief Returns the requested false-positive rate
+     * @return False-positive rate
+     */
+    double FalsePositiveRate() const;
+
+private:
+    /**
+     * @struct Block
+     * @brief 512 bits of the filter, aligned to a cache line
+     */
+    struct alignas(64) Block
+    {
+        /**
+         * @brief Bits of the block
+         */
+        std::uint64_t aWords[8];
+    };
+
+    /**
+     * @brief Mixes the bits of a data into a 64-bit hash
+     * @param[in] inData Data to hash
+     * @return Hash of the data
+     */
+    static std::uint64_t Hash(int inData);
+
+    /**
+     * @brief Blocks of the filter
+     */
+    std::vector<Block> _vBlocks;
+
+    /**
+     * @brief Number of data the filter is sized for
+     */
+    int _nCapacity;
+
+    /**
+     * @brief Requested false-positive rate
+     */
+    double _dFalsePositiveRate;
+
+    /**
+     * @brief Number of bits set per data
+     */
+    int _nBitsPerData;
+};
+
+#endif // _BLOOMFILTER_H_
@@ -0,0 +1,128 @@
+//-------------------------------------------------------------------
+/**
+ * @file DenseKeyBitmap.h
+ * @brief Header file for the DenseKeyBitmap class.
+ * @author Aditya Jedhe
+ * @date 2025-03-14
+ */
+//-------------------------------------------------------------------
+
+#ifndef _DENSEKEYBITMAP_H_
+#define _DENSEKEYBITMAP_H_
+
+// ---------------------------------------------- System Headers
+#include <cstdint>
+#include <vector>
+
+//-------------------------------------------------------------------
+/**
+ * @class DenseKeyBitmap
+ * @brief Bitmap with one bit per integer of a range, telling which data is present, with rank support.
+ * @details Membership is a single bit test. The bits are grouped in blocks of 512 (one cache line) and a
+ * Fenwick tree over the number of set bits per block answers how many data are less than a given one with
+ * O(log b) additions and at most eight popcounts, b being the number of blocks, while a bit changes at the
+ * same cost.
+ * @note Set() and Clear() update the bits and the counts atomically, so several threads may set bits at the
+ * same time.
+ */
+class DenseKeyBitmap
+{
+public:
+    /**
+     * @brief Constructor for DenseKeyBitmap
+     * @param[in] inMinData Smallest data of the range
+     * @param[in] inMaxData Largest data of the range
+     * @note All bits are clear.
+     */
+    DenseKeyBitmap(int inMinData,
+                   int inMaxData);
+
+    /**
+     * @brief Destructor for DenseKeyBitmap
+     */
+    virtual ~DenseKeyBitmap();
+
+    /**
+     * @brief Checks if the data lies within the range of the bitmap
+     * @param[in] inData Data to check
+     * @return True if the data has a bit, false otherwise
+     */
+    bool Covers(int inData) const;
+
+    /**
+     * @brief Marks a data as present
+     * @param[in] inData Data within the range
+     */
+    void Set(int inData);
+
+    /**
+     * @brief Marks a data as absent
+     * @param[in] inData Data within the range
+     */
+    void Clear(int inData);
+
+    /**
+     * @brief Checks if a data is present
+     * @param[in] inData Data to check
+     * @return True if the data is within the range and marked present, false otherwise
+     * @note The bit is loaded atomically, so it may be tested while other threads set bits.
+     */
+    bool Test(int inData) const;
+
+    /**
+     * @brief Counts the data marked present which are less than the given data
+     * @param[in] inData Data to compare with, within the range or not
+     * @return Number of present data less than the given data
+     */
+    int Rank(int inData) const;
+
+    /**
+     * @brief Returns the number of data marked present
+     * @return Number of present data
+     */
+    int Count() const;
+
+private:
+    /**
+     * @brief Number of 64-bit words per block
+     */
+    static constexpr int _nWordsPerBlock = 8;
+
+    /**
+     * @brief Returns the bit index of a data within the range
+     * @param[in] inData Data covered by the range
+     * @return Distance from the smallest data of the range, up to 2^32 - 1
+     * @note It is a constant member function.
+     */
+    std::uint64_t OffsetOf(int inData) const;
+
+    /**
+     * @brief Adds to the number of set bits of a block
+     * @param[in] inBlock Block index
+     * @param[in] inDelta Number to add
+     */
+    void AddToBlockCount(int inBlock,
+                         int inDelta);
+
+    /**
+     * @brief Bits of the range, bit i standing for the data _nMinData + i
+     */
+    std::vector<std::uint64_t> _vWords;
+
+    /**
+     * @brief Fenwick tree over the number of set bits per block, 1-based
+     */
+    std::vector<int> _vBlockCounts;
+
+    /**
+     * @brief Smallest data of the range
+     */
+    long long _nMinData;
+
+    /**
+     * @brief Largest data of the range
+     */
+    long long _nMaxData;
+};
+
+#endif // _DENSEKEYBITMAP_H_
@@ -0,0 +1,127 @@
+//-------------------------------------------------------------------
+/**
+ * @file EytzingerSnapshot.h
+ * @brief Header file for the EytzingerSnapshot class.
+ * @author Aditya Jedhe
+ * @date 2025-03-11
+ */
+//-------------------------------------------------------------------
+
+#ifndef _EYTZINGERSNAPSHOT_H_
+#define _EYTZINGERSNAPSHOT_H_
+
+// ---------------------------------------------- System Headers
+#include <vector>
+
+// ---------------------------------------------- Forward declaration
+class BinaryTree;
+
+//-------------------------------------------------------------------
+/**
+ * @class EytzingerSnapshot
+ * @brief Read-only copy of the data of a binary tree in Eytzinger order for search-heavy phases.
+ * @details The sorted data is stored in one array in the level order of a complete binary search tree: slot 1
+ * holds the root and slot k has its children in slots 2k and 2k+1. A search needs no pointer and no branch on
+ * the data, as the next slot is computed from the comparison. The 16 descendants four levels below a slot share
+ * one cache line, which is prefetched while the four levels in between are compared.
+ * @note The snapshot does not follow later modifications of the binary tree. Refresh() copies it again.
+ */
+class EytzingerSnapshot
+{
+public:
+    /**
+     * @brief Constructor for EytzingerSnapshot
+     * @param[in] ipBinaryTree Binary tree to copy the data from, duplicates included
+     */
+    EytzingerSnapshot(BinaryTree *ipBinaryTree);
+
+    /**
+     * @brief Destructor for EytzingerSnapshot
+     */
+    virtual ~EytzingerSnapshot();
+
+    /**
+     * @brief Copies the data of the binary tree again, e.g. after a write phase
+     * @details The storage of the previous copy is reused, so a refresh of a binary tree whose size has not
+     * grown allocates no memory. A binary search tree is read in order; the data of any other binary tree
+     * is sorted first.
+     * @param[in] ipBinaryTree Binary tree to copy the data from
+     */
+    void Refresh(BinaryTree *ipBinaryTree);
+
+    /**
+     * @brief Checks if the data is present
+     * @param[in] inData Data to search for
+     * @return True if the data is present, false otherwise
+     */
+    bool Search(int inData) const;
+
+    /**
+     * @brief Finds the smallest data which is not less than the given data
+     * @param[in] inData Data to compare with
+     * @param[out] onData Found data
+     * @return True if such a data exists, false otherwise
+     */
+    bool LowerBound(int inData,
+                    int &onData) const;
+
+    /**
+     * @brief Finds the smallest data which is greater than the given data
+     * @param[in] inData Data to compare with
+     * @param[out] onData Found data
+     * @return True if such a data exists, false otherwise
+     */
+    bool UpperBound(int inData,
+                    int &onData) const;
+
+    /**
+     * @brief Returns the number of data in the snapshot
+     * @return Number of data, each occurrence of a duplicate counted
+     */
+    int Size() const;
+
+private:
+    /**
+     * @struct Line
+     * @brief 16 slots of the array, aligned to a cache line
+     */
+    struct alignas(64) Line
+    {
+        /**
+         * @brief Data of the slots
+         */
+        int aData[16];
+    };
+
+    /**
+     * @brief Places the sorted data into the slots of a sub-tree in in-order sequence
+     * @param[in] inSlot Slot of the root of the sub-tree
+     * @param[in, out] ionNext Index of the next sorted data to place
+     */
+    void Layout(int inSlot,
+                int &ionNext);
+
+    /**
+     * @brief Finds the slot of the smallest data which is not less than the given data
+     * @param[in] inData Data to compare with
+     * @return Slot of the found data, 0 if all data is less than the given data
+     */
+    int DescendToLowerBound(int inData) const;
+
+    /**
+     * @brief Cache lines holding the slots. Slot 0 is not used.
+     */
+    std::vector<Line> _vLines;
+
+    /**
+     * @brief Sorted data read from the binary tree, kept to reuse its storage
+     */
+    std::vector<int> _vSortedData;
+
+    /**
+     * @brief Number of data in the snapshot
+     */
+    int _nSize;
+};
+
+#endif // _EYTZINGERSNAPSHOT_H_
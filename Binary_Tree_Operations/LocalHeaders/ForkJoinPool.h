@@ -0,0 +1,122 @@
+//-------------------------------------------------------------------
+/**
+ * @file ForkJoinPool.h
+ * @brief Header file for the ForkJoinPool class.
+ * @author Aditya Jedhe
+ * @date 2025-03-22
+ */
+//-------------------------------------------------------------------
+
+#ifndef _FORKJOINPOOL_H_
+#define _FORKJOINPOOL_H_
+
+// ---------------------------------------------- System Headers
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//-------------------------------------------------------------------
+/**
+ * @class ForkJoinPool
+ * @brief Fixed set of worker threads running the forked halves of divide-and-conquer algorithms.
+ * @details The workers are started once for the whole process, one less than the hardware threads since the
+ * calling thread works as well. Invoke() offers one task to the workers and runs the other one itself. If no
+ * worker took the offered task meanwhile, the caller runs it too, otherwise it runs other offered tasks until
+ * the worker is done, so a nested fork never blocks a thread that could work.
+ * @note Tasks must not throw.
+ */
+class ForkJoinPool
+{
+public:
+    /**
+     * @brief Returns the pool shared by the whole process
+     * @return Reference to the pool, whose workers are started on the first call
+     */
+    static ForkJoinPool &RetrieveInstance();
+
+    /**
+     * @brief Destructor for ForkJoinPool
+     * @details Stops and joins the workers once the tasks offered are done.
+     */
+    virtual ~ForkJoinPool();
+
+    /**
+     * @brief Runs two tasks, possibly at the same time, and returns once both are done
+     * @param[in] ifnFirstTask Task offered to the workers
+     * @param[in] ifnSecondTask Task run by the calling thread
+     */
+    void Invoke(const std::function<void()> &ifnFirstTask,
+                const std::function<void()> &ifnSecondTask);
+
+    /**
+     * @brief Returns the number of worker threads
+     * @return Number of worker threads, 0 on a single hardware thread
+     * @note It is a constant member function.
+     */
+    int WorkerCount() const;
+
+private:
+    /**
+     * @struct Task
+     * @brief Task offered to the workers by Invoke()
+     */
+    struct Task
+    {
+        /**
+         * @brief Function to run, owned by the caller of Invoke()
+         */
+        const std::function<void()> *pfnTask;
+
+        /**
+         * @brief True once a worker has run the function
+         */
+        bool bDone;
+    };
+
+    /**
+     * @brief Constructor for ForkJoinPool
+     * @param[in] inWorkerCount Number of worker threads to start
+     */
+    ForkJoinPool(int inWorkerCount);
+
+    /**
+     * @brief Takes offered tasks until the pool is stopped
+     */
+    void RunWorker();
+
+    /**
+     * @brief Runs a task taken from the queue and marks it done
+     * @param[in] ipTask Task removed from the queue
+     */
+    void RunTask(Task *ipTask);
+
+    /**
+     * @brief Worker threads
+     */
+    std::vector<std::thread> _vWorkers;
+
+    /**
+     * @brief Tasks offered and not taken yet, oldest first
+     */
+    std::deque<Task *> _dqTasks;
+
+    /**
+     * @brief Guards the queue, the done flags of the tasks and the stop flag
+     */
+    std::mutex _objMutex;
+
+    /**
+     * @brief Signalled when a task is offered or done and when the pool stops
+     */
+    std::condition_variable _objCondition;
+
+    /**
+     * @brief True once the workers are to stop
+     */
+    bool _bStopping;
+};
+
+#endif // _FORKJOINPOOL_H_
@@ -0,0 +1,160 @@
+//-------------------------------------------------------------------
+/**
+ * @file NodeIndex.h
+ * @brief Header file for the NodeIndex class.
+ * @author Aditya Jedhe
+ * @date 2025-03-04
+ */
+//-------------------------------------------------------------------
+
+#ifndef _NODEINDEX_H_
+#define _NODEINDEX_H_
+
+// ---------------------------------------------- System Headers
+#include <vector>
+
+// ---------------------------------------------- Forward declaration
+class Node;
+
+//-------------------------------------------------------------------
+/**
+ * @class NodeIndex
+ * @brief Hash index from the data of a node to the node, its parent node and its depth.
+ * @details The index uses open addressing with linear probing in a power-of-two table, so a lookup touches
+ * one or two adjacent cache lines. The table is kept at most half full and deletions shift the following
+ * entries back instead of leaving tombstones.
+ * @note Several nodes may hold the same data. Each of them has its own entry and a lookup by data returns
+ * the shallowest one.
+ */
+class NodeIndex
+{
+public:
+    /**
+     * @struct Entry
+     * @brief Indexed node along with its parent node, its depth and its position in level order
+     */
+    struct Entry
+    {
+        /**
+         * @brief Data of the node
+         */
+        int nData;
+
+        /**
+         * @brief Number of edges from the root node to the node
+         */
+        int nDepth;
+
+        /**
+         * @brief Position of the node in level order, 0 for the root node
+         */
+        int nPosition;
+
+        /**
+         * @brief Indexed node, nullptr for an empty entry
+         */
+        Node *pNode;
+
+        /**
+         * @brief Parent of the indexed node, nullptr for the root node
+         */
+        Node *pParentNode;
+    };
+
+    /**
+     * @brief Constructor for NodeIndex
+     * @param[in] inExpectedCount Number of nodes to reserve space for
+     */
+    NodeIndex(int inExpectedCount = 0);
+
+    /**
+     * @brief Destructor for NodeIndex
+     */
+    virtual ~NodeIndex();
+
+    /**
+     * @brief Reserves space so that the given number of nodes is indexed without growing the table
+     * @param[in] inCount Number of nodes
+     */
+    void Reserve(int inCount);
+
+    /**
+     * @brief Adds a node to the index
+     * @param[in] inData Data of the node
+     * @param[in] ipNode Node to index
+     * @param[in] ipParentNode Parent of the node, nullptr for the root node
+     * @param[in] inPosition Position of the node in level order, its depth follows from it
+     */
+    void Insert(int inData,
+                Node *ipNode,
+                Node *ipParentNode,
+                int inPosition);
+
+    /**
+     * @brief Removes a node from the index
+     * @param[in] inData Data of the node
+     * @param[in] ipNode Node to remove
+     */
+    void Remove(int inData,
+                const Node *ipNode);
+
+    /**
+     * @brief Finds the shallowest node holding the given data
+     * @param[in] inData Data to search for
+     * @return Pointer to the entry of the node. Otherwise nullptr.
+     * @note The entry is valid until the index is modified.
+     */
+    Entry *Find(int inData);
+
+    /**
+     * @brief Finds the entry of the given node
+     * @param[in] inData Data of the node
+     * @param[in] ipNode Node to search for
+     * @return Pointer to the entry of the node. Otherwise nullptr.
+     * @note The entry is valid until the index is modified.
+     */
+    Entry *Find(int inData,
+                const Node *ipNode);
+
+    /**
+     * @brief Removes all nodes from the index
+     */
+    void Clear();
+
+    /**
+     * @brief Returns the number of indexed nodes
+     * @return Number of indexed nodes
+     */
+    int Size() const;
+
+private:
+    /**
+     * @brief Returns the home slot of the given data in the table
+     * @param[in] inData Data to hash
+     * @return Slot index
+     */
+    int HomeSlot(int inData) const;
+
+    /**
+     * @brief Resizes the table and re-inserts all entries
+     * @param[in] inCapacity New number of slots, a power of two
+     */
+    void Rehash(int inCapacity);
+
+    /**
+     * @brief Slots of the hash table
+     */
+    std::vector<Entry> _vEntries;
+
+    /**
+     * @brief Number of occupied slots
+     */
+    int _nSize;
+
+    /**
+     * @brief Number of bits of the slot index
+     */
+    int _nBits;
+};
+
+#endif // _NODEINDEX_H_
@@ -0,0 +1,127 @@
+//-------------------------------------------------------------------
+/**
+ * @file VanEmdeBoasSnapshot.h
+ * @brief Header file for the VanEmdeBoasSnapshot class.
+ * @author Aditya Jedhe
+ * @date 2025-03-12
+ */
+//-------------------------------------------------------------------
+
+#ifndef _VANEMDEBOASSNAPSHOT_H_
+#define _VANEMDEBOASSNAPSHOT_H_
+
+// ---------------------------------------------- System Headers
+#include <vector>
+
+// ---------------------------------------------- Forward declaration
+class BinaryTree;
+class Node;
+
+//-------------------------------------------------------------------
+/**
+ * @class VanEmdeBoasSnapshot
+ * @brief Read-only copy of a binary tree, shape included, in van Emde Boas order.
+ * @details The tree of h levels is cut at half its height into a top tree and the bottom trees hanging below
+ * it. Each of them is laid out the same way, recursively, the top tree first and the bottom trees after it
+ * from left to right. A sub-tree of any height is thus stored in a few contiguous runs. A root-to-leaf path
+ * of a balanced tree then touches O(log_B n) blocks for every block size B at once, whether B is a cache line,
+ * a page or anything in between, and the nodes of a sub-tree are close to each other.
+ * @note The snapshot does not follow later modifications of the binary tree. Refresh() copies it again.
+ */
+class VanEmdeBoasSnapshot
+{
+public:
+    /**
+     * @brief Constructor for VanEmdeBoasSnapshot
+     * @param[in] ipBinaryTree Binary tree to copy, complete, binary search tree or any other
+     */
+    VanEmdeBoasSnapshot(BinaryTree *ipBinaryTree);
+
+    /**
+     * @brief Destructor for VanEmdeBoasSnapshot
+     */
+    virtual ~VanEmdeBoasSnapshot();
+
+    /**
+     * @brief Copies the binary tree again, e.g. after a write phase
+     * @param[in] ipBinaryTree Binary tree to copy
+     */
+    void Refresh(BinaryTree *ipBinaryTree);
+
+    /**
+     * @brief Checks if the data is present
+     * @details A copy of a binary search tree is descended from the root node, any other copy is searched
+     * depth-first.
+     * @param[in] inData Data to search for
+     * @return True if the data is present, false otherwise
+     */
+    bool Search(int inData) const;
+
+    /**
+     * @brief Retrieves the data of a node and of all its decendants in pre-order sequence
+     * @param[in] inData Data of the node
+     * @param[out] ovData Data of the node and its decendants, empty if the data is not present
+     */
+    void RetrieveDecendants(int inData,
+                            std::vector<int> &ovData) const;
+
+    /**
+     * @brief Prints all decendant nodes of a given data
+     * @param[in] inData Data of a node whose decendants are to be printed
+     * @see BinaryTree::PrintDecendants() for the same output from the binary tree
+     */
+    void PrintDecendants(int inData) const;
+
+    /**
+     * @brief Returns the number of nodes in the snapshot
+     * @return Number of nodes
+     */
+    int Size() const;
+
+private:
+    /**
+     * @struct Entry
+     * @brief Copied node with the positions of its children
+     */
+    struct Entry
+    {
+        /**
+         * @brief Data of the node
+         */
+        int nData;
+
+        /**
+         * @brief Positions of the left child (index 0) and the right child (index 1), -1 for none
+         */
+        int anChildIdx[2];
+    };
+
+    /**
+     * @brief Appends the nodes of a sub-tree in van Emde Boas order
+     * @param[in] ipNode Root node of the sub-tree
+     * @param[in] inLevels Number of levels of the sub-tree to append
+     * @param[in, out] iovNodes Nodes in van Emde Boas order
+     */
+    static void Layout(Node *ipNode,
+                       int inLevels,
+                       std::vector<Node *> &iovNodes);
+
+    /**
+     * @brief Finds the position of the node with the given data
+     * @param[in] inData Data to search for
+     * @return Position of the node, -1 if the data is not present
+     */
+    int Find(int inData) const;
+
+    /**
+     * @brief Copied nodes in van Emde Boas order, the root node first
+     */
+    std::vector<Entry> _vEntries;
+
+    /**
+     * @brief True if the copied binary tree holds the binary search tree property
+     */
+    bool _bOrderedTree;
+};
+
+#endif // _VANEMDEBOASSNAPSHOT_H_
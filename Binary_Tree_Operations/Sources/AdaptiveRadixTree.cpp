@@ -0,0 +1,652 @@
+//-------------------------------------------------------------------
+/**
+ * @file AdaptiveRadixTree.cpp
+ * @brief Implementation file for the AdaptiveRadixTree class.
+ * @author Aditya Jedhe
+ * @date 2025-03-15
+ */
+//-------------------------------------------------------------------
+
+// ---------------------------------------------- Local Headers
+#include "AdaptiveRadixTree.h"
+
+// ---------------------------------------------- System Headers
+#include <bit>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+//-------------------------------------------------------------------
+AdaptiveRadixTree::AdaptiveRadixTree() : _pRootNode(nullptr),
+                                         _nSize(0)
+{
+}
+
+//-------------------------------------------------------------------
+AdaptiveRadixTree::~AdaptiveRadixTree()
+{
+    Clear();
+}
+
+//-------------------------------------------------------------------
+bool AdaptiveRadixTree::Insert(int inData,
+                               Node *ipNode)
+{
+    if (nullptr == ipNode)
+    {
+        return false;
+    }
+
+    std::uint8_t anBytes[_nLevels];
+
+    SplitData(inData, anBytes);
+
+    if (nullptr == _pRootNode)
+    {
+        _pRootNode = CreateRadixNode(RADIX_NODE_4, nullptr, nullptr, 0);
+    }
+
+    void **ppSlot = &_pRootNode;
+
+    for (int nLevel = 0; nLevel < _nLevels; ++nLevel)
+    {
+        const bool bLastLevel = ((_nLevels - 1) == nLevel);
+
+        void **ppChild = FindChild(static_cast<RadixNode *>(*ppSlot), anBytes[nLevel]);
+
+        if (nullptr != ppChild)
+        {
+            if (bLastLevel)
+            {
+                return false;
+            }
+
+            ppSlot = ppChild;
+            continue;
+        }
+
+        /**
+         * The last level holds the node itself, the levels above get
+         * a new inner node for the rest of the bytes
+         */
+        AddChild(ppSlot,
+                 anBytes[nLevel],
+                 bLastLevel ? static_cast<void *>(ipNode) : CreateRadixNode(RADIX_NODE_4, nullptr, nullptr, 0));
+
+        if (bLastLevel)
+        {
+            break;
+        }
+
+        ppSlot = FindChild(static_cast<RadixNode *>(*ppSlot), anBytes[nLevel]);
+    }
+
+    ++_nSize;
+
+    return true;
+}
+
+//-------------------------------------------------------------------
+bool AdaptiveRadixTree::Replace(int inData,
+                                Node *ipNode)
+{
+    if (nullptr == ipNode)
+    {
+        return false;
+    }
+
+    std::uint8_t anBytes[_nLevels];
+
+    SplitData(inData, anBytes);
+
+    void *pSlot = _pRootNode;
+    void **ppChild = nullptr;
+
+    for (int nLevel = 0; (nLevel < _nLevels) && (nullptr != pSlot); ++nLevel)
+    {
+        ppChild = FindChild(static_cast<RadixNode *>(pSlot), anBytes[nLevel]);
+
+        pSlot = (nullptr != ppChild) ? *ppChild : nullptr;
+    }
+
+    if (nullptr == pSlot)
+    {
+        return false;
+    }
+
+    *ppChild = ipNode;
+
+    return true;
+}
+
+//-------------------------------------------------------------------
+bool AdaptiveRadixTree::Remove(int inData)
+{
+    std::uint8_t anBytes[_nLevels];
+
+    SplitData(inData, anBytes);
+
+    /**
+     * Slots holding the inner node of each level, so an inner node
+     * left without children can be removed from the level above
+     */
+    void **appSlots[_nLevels];
+
+    void **ppSlot = &_pRootNode;
+
+    for (int nLevel = 0; nLevel < _nLevels; ++nLevel)
+    {
+        if (nullptr == *ppSlot)
+        {
+            return false;
+        }
+
+        appSlots[nLevel] = ppSlot;
+
+        ppSlot = FindChild(static_cast<RadixNode *>(*ppSlot), anBytes[nLevel]);
+
+        if (nullptr == ppSlot)
+        {
+            return false;
+        }
+    }
+
+    for (int nLevel = _nLevels - 1; nLevel >= 0; --nLevel)
+    {
+        RemoveChild(appSlots[nLevel], anBytes[nLevel]);
+
+        if (nullptr != *appSlots[nLevel])
+        {
+            break;
+        }
+    }
+
+    --_nSize;
+
+    return true;
+}
+
+//-------------------------------------------------------------------
+Node *AdaptiveRadixTree::Find(int inData) const
+{
+    std::uint8_t anBytes[_nLevels];
+
+    SplitData(inData, anBytes);
+
+    void *pSlot = _pRootNode;
+
+    for (int nLevel = 0; (nLevel < _nLevels) && (nullptr != pSlot); ++nLevel)
+    {
+        void **ppChild = FindChild(static_cast<RadixNode *>(pSlot), anBytes[nLevel]);
+
+        pSlot = (nullptr != ppChild) ? *ppChild : nullptr;
+    }
+
+    return static_cast<Node *>(pSlot);
+}
+
+//-------------------------------------------------------------------
+void AdaptiveRadixTree::Clear()
+{
+    if (nullptr != _pRootNode)
+    {
+        DeleteSubRadixTree(static_cast<RadixNode *>(_pRootNode), 0);
+    }
+
+    _pRootNode = nullptr;
+    _nSize = 0;
+}
+
+//-------------------------------------------------------------------
+int AdaptiveRadixTree::Size() const
+{
+    return _nSize;
+}
+
+//===================================================================
+// Private Methods: Implementation
+//===================================================================
+
+//-------------------------------------------------------------------
+void AdaptiveRadixTree::SplitData(int inData,
+                                  std::uint8_t (&oaBytes)[_nLevels])
+{
+    std::uint32_t nKey = (std::uint32_t)(inData) ^ 0x80000000u;
+
+    for (int nLevel = _nLevels - 1; nLevel >= 0; --nLevel, nKey >>= 8)
+    {
+        oaBytes[nLevel] = (std::uint8_t)(nKey);
+    }
+}
+
+//-------------------------------------------------------------------
+int AdaptiveRadixTree::Capacity(RadixNodeType ieType)
+{
+    switch (ieType)
+    {
+    case RADIX_NODE_4:
+        return 4;
+    case RADIX_NODE_16:
+        return 16;
+    case RADIX_NODE_48:
+        return 48;
+    default:
+        return 256;
+    }
+}
+
+//-------------------------------------------------------------------
+AdaptiveRadixTree::RadixNode *AdaptiveRadixTree::CreateRadixNode(RadixNodeType ieType,
+                                                                 const std::uint8_t *ipBytes,
+                                                                 void *const *ipChildren,
+                                                                 int inCount)
+{
+    RadixNode *pNode = nullptr;
+
+    switch (ieType)
+    {
+    case RADIX_NODE_4:
+    {
+        RadixNode4 *pNode4 = new RadixNode4{};
+
+        for (int nIdx = 0; nIdx < inCount; ++nIdx)
+        {
+            pNode4->anBytes[nIdx] = ipBytes[nIdx];
+            pNode4->apChildren[nIdx] = ipChildren[nIdx];
+        }
+
+        pNode = pNode4;
+        break;
+    }
+    case RADIX_NODE_16:
+    {
+        RadixNode16 *pNode16 = new RadixNode16{};
+
+        for (int nIdx = 0; nIdx < inCount; ++nIdx)
+        {
+            pNode16->anBytes[nIdx] = ipBytes[nIdx];
+            pNode16->apChildren[nIdx] = ipChildren[nIdx];
+        }
+
+        pNode = pNode16;
+        break;
+    }
+    case RADIX_NODE_48:
+    {
+        RadixNode48 *pNode48 = new RadixNode48{};
+
+        for (int nIdx = 0; nIdx < inCount; ++nIdx)
+        {
+            pNode48->anSlots[ipBytes[nIdx]] = (std::uint8_t)(nIdx + 1);
+            pNode48->apChildren[nIdx] = ipChildren[nIdx];
+        }
+
+        pNode = pNode48;
+        break;
+    }
+    default:
+    {
+        RadixNode256 *pNode256 = new RadixNode256{};
+
+        for (int nIdx = 0; nIdx < inCount; ++nIdx)
+        {
+            pNode256->apChildren[ipBytes[nIdx]] = ipChildren[nIdx];
+        }
+
+        pNode = pNode256;
+        break;
+    }
+    }
+
+    pNode->eType = ieType;
+    pNode->nChildCount = (std::uint16_t)(inCount);
+
+    return pNode;
+}
+
+//-------------------------------------------------------------------
+void AdaptiveRadixTree::DeleteRadixNode(RadixNode *ipNode)
+{
+    switch (ipNode->eType)
+    {
+    case RADIX_NODE_4:
+        delete static_cast<RadixNode4 *>(ipNode);
+        break;
+    case RADIX_NODE_16:
+        delete static_cast<RadixNode16 *>(ipNode);
+        break;
+    case RADIX_NODE_48:
+        delete static_cast<RadixNode48 *>(ipNode);
+        break;
+    default:
+        delete static_cast<RadixNode256 *>(ipNode);
+        break;
+    }
+}
+
+//-------------------------------------------------------------------
+void AdaptiveRadixTree::DeleteSubRadixTree(RadixNode *ipNode,
+                                           int inLevel)
+{
+    if ((_nLevels - 1) > inLevel)
+    {
+        std::uint8_t anBytes[256];
+        void *apChildren[256];
+
+        int nCount = CollectChildren(ipNode, anBytes, apChildren);
+
+        for (int nIdx = 0; nIdx < nCount; ++nIdx)
+        {
+            DeleteSubRadixTree(static_cast<RadixNode *>(apChildren[nIdx]), inLevel + 1);
+        }
+    }
+
+    DeleteRadixNode(ipNode);
+}
+
+//-------------------------------------------------------------------
+int AdaptiveRadixTree::CollectChildren(const RadixNode *ipNode,
+                                       std::uint8_t *opBytes,
+                                       void **opChildren)
+{
+    int nCount(0);
+
+    switch (ipNode->eType)
+    {
+    case RADIX_NODE_4:
+    {
+        const RadixNode4 *pNode4 = static_cast<const RadixNode4 *>(ipNode);
+
+        for (; nCount < pNode4->nChildCount; ++nCount)
+        {
+            opBytes[nCount] = pNode4->anBytes[nCount];
+            opChildren[nCount] = pNode4->apChildren[nCount];
+        }
+
+        break;
+    }
+    case RADIX_NODE_16:
+    {
+        const RadixNode16 *pNode16 = static_cast<const RadixNode16 *>(ipNode);
+
+        for (; nCount < pNode16->nChildCount; ++nCount)
+        {
+            opBytes[nCount] = pNode16->anBytes[nCount];
+            opChildren[nCount] = pNode16->apChildren[nCount];
+        }
+
+        break;
+    }
+    case RADIX_NODE_48:
+    {
+        const RadixNode48 *pNode48 = static_cast<const RadixNode48 *>(ipNode);
+
+        for (int nByte = 0; nByte < 256; ++nByte)
+        {
+            if (0 != pNode48->anSlots[nByte])
+            {
+                opBytes[nCount] = (std::uint8_t)(nByte);
+                opChildren[nCount++] = pNode48->apChildren[pNode48->anSlots[nByte] - 1];
+            }
+        }
+
+        break;
+    }
+    default:
+    {
+        const RadixNode256 *pNode256 = static_cast<const RadixNode256 *>(ipNode);
+
+        for (int nByte = 0; nByte < 256; ++nByte)
+        {
+            if (nullptr != pNode256->apChildren[nByte])
+            {
+                opBytes[nCount] = (std::uint8_t)(nByte);
+                opChildren[nCount++] = pNode256->apChildren[nByte];
+            }
+        }
+
+        break;
+    }
+    }
+
+    return nCount;
+}
+
+//-------------------------------------------------------------------
+void **AdaptiveRadixTree::FindChild(RadixNode *ipNode,
+                                    std::uint8_t inByte)
+{
+    switch (ipNode->eType)
+    {
+    case RADIX_NODE_4:
+    {
+        RadixNode4 *pNode4 = static_cast<RadixNode4 *>(ipNode);
+
+        for (int nIdx = 0; nIdx < pNode4->nChildCount; ++nIdx)
+        {
+            if (inByte == pNode4->anBytes[nIdx])
+            {
+                return &pNode4->apChildren[nIdx];
+            }
+        }
+
+        return nullptr;
+    }
+    case RADIX_NODE_16:
+    {
+        RadixNode16 *pNode16 = static_cast<RadixNode16 *>(ipNode);
+
+#if defined(__SSE2__)
+        /**
+         * Compare the byte against all 16 bytes at once and keep the
+         * lanes holding a child
+         */
+        __m128i vMatches = _mm_cmpeq_epi8(_mm_set1_epi8((char)(inByte)),
+                                          _mm_loadu_si128(reinterpret_cast<const __m128i *>(pNode16->anBytes)));
+
+        unsigned int nMask = (unsigned int)(_mm_movemask_epi8(vMatches)) & ((1u << pNode16->nChildCount) - 1);
+
+        return (0 != nMask) ? &pNode16->apChildren[std::countr_zero(nMask)] : nullptr;
+#else
+        for (int nIdx = 0; nIdx < pNode16->nChildCount; ++nIdx)
+        {
+            if (inByte == pNode16->anBytes[nIdx])
+            {
+                return &pNode16->apChildren[nIdx];
+            }
+        }
+
+        return nullptr;
+#endif
+    }
+    case RADIX_NODE_48:
+    {
+        RadixNode48 *pNode48 = static_cast<RadixNode48 *>(ipNode);
+
+        return (0 != pNode48->anSlots[inByte]) ? &pNode48->apChildren[pNode48->anSlots[inByte] - 1] : nullptr;
+    }
+    default:
+    {
+        RadixNode256 *pNode256 = static_cast<RadixNode256 *>(ipNode);
+
+        return (nullptr != pNode256->apChildren[inByte]) ? &pNode256->apChildren[inByte] : nullptr;
+    }
+    }
+}
+
+//-------------------------------------------------------------------
+void AdaptiveRadixTree::AddChild(void **iopSlot,
+                                 std::uint8_t inByte,
+                                 void *ipChild)
+{
+    RadixNode *pNode = static_cast<RadixNode *>(*iopSlot);
+
+    if (pNode->nChildCount == Capacity(pNode->eType))
+    {
+        std::uint8_t anBytes[256];
+        void *apChildren[256];
+
+        int nCount = CollectChildren(pNode, anBytes, apChildren);
+        int nPos(nCount);
+
+        while ((0 < nPos) && (anBytes[nPos - 1] > inByte))
+        {
+            anBytes[nPos] = anBytes[nPos - 1];
+            apChildren[nPos] = apChildren[nPos - 1];
+            --nPos;
+        }
+
+        anBytes[nPos] = inByte;
+        apChildren[nPos] = ipChild;
+
+        *iopSlot = CreateRadixNode((RadixNodeType)(pNode->eType + 1), anBytes, apChildren, nCount + 1);
+
+        DeleteRadixNode(pNode);
+
+        return;
+    }
+
+    switch (pNode->eType)
+    {
+    case RADIX_NODE_4:
+    case RADIX_NODE_16:
+    {
+        std::uint8_t *pBytes = (RADIX_NODE_4 == pNode->eType) ? static_cast<RadixNode4 *>(pNode)->anBytes
+                                                              : static_cast<RadixNode16 *>(pNode)->anBytes;
+        void **pChildren = (RADIX_NODE_4 == pNode->eType) ? static_cast<RadixNode4 *>(pNode)->apChildren
+                                                          : static_cast<RadixNode16 *>(pNode)->apChildren;
+
+        int nPos(pNode->nChildCount);
+
+        while ((0 < nPos) && (pBytes[nPos - 1] > inByte))
+        {
+            pBytes[nPos] = pBytes[nPos - 1];
+            pChildren[nPos] = pChildren[nPos - 1];
+            --nPos;
+        }
+
+        pBytes[nPos] = inByte;
+        pChildren[nPos] = ipChild;
+
+        break;
+    }
+    case RADIX_NODE_48:
+    {
+        RadixNode48 *pNode48 = static_cast<RadixNode48 *>(pNode);
+
+        /**
+         * Removals leave holes anywhere in the slots, the slot past
+         * the children is free only until the first removal
+         */
+        int nSlot(0);
+
+        while (nullptr != pNode48->apChildren[nSlot])
+        {
+            ++nSlot;
+        }
+
+        pNode48->anSlots[inByte] = (std::uint8_t)(nSlot + 1);
+        pNode48->apChildren[nSlot] = ipChild;
+
+        break;
+    }
+    default:
+        static_cast<RadixNode256 *>(pNode)->apChildren[inByte] = ipChild;
+        break;
+    }
+
+    ++pNode->nChildCount;
+}
+
+//-------------------------------------------------------------------
+void AdaptiveRadixTree::RemoveChild(void **iopSlot,
+                                    std::uint8_t inByte)
+{
+    RadixNode *pNode = static_cast<RadixNode *>(*iopSlot);
+
+    switch (pNode->eType)
+    {
+    case RADIX_NODE_4:
+    case RADIX_NODE_16:
+    {
+        std::uint8_t *pBytes = (RADIX_NODE_4 == pNode->eType) ? static_cast<RadixNode4 *>(pNode)->anBytes
+                                                              : static_cast<RadixNode16 *>(pNode)->anBytes;
+        void **pChildren = (RADIX_NODE_4 == pNode->eType) ? static_cast<RadixNode4 *>(pNode)->apChildren
+                                                          : static_cast<RadixNode16 *>(pNode)->apChildren;
+
+        int nPos(0);
+
+        while (pBytes[nPos] != inByte)
+        {
+            ++nPos;
+        }
+
+        for (; nPos < (pNode->nChildCount - 1); ++nPos)
+        {
+            pBytes[nPos] = pBytes[nPos + 1];
+            pChildren[nPos] = pChildren[nPos + 1];
+        }
+
+        pBytes[nPos] = 0;
+        pChildren[nPos] = nullptr;
+
+        break;
+    }
+    case RADIX_NODE_48:
+    {
+        RadixNode48 *pNode48 = static_cast<RadixNode48 *>(pNode);
+
+        pNode48->apChildren[pNode48->anSlots[inByte] - 1] = nullptr;
+        pNode48->anSlots[inByte] = 0;
+
+        break;
+    }
+    default:
+        static_cast<RadixNode256 *>(pNode)->apChildren[inByte] = nullptr;
+        break;
+    }
+
+    --pNode->nChildCount;
+
+    if (0 == pNode->nChildCount)
+    {
+        DeleteRadixNode(pNode);
+        *iopSlot = nullptr;
+
+        return;
+    }
+
+    /**
+     * Shrink well below the capacity of the smaller type, so that a
+     * node at the boundary does not flip between types
+     */
+    int nShrinkCount(0);
+
+    switch (pNode->eType)
+    {
+    case RADIX_NODE_16:
+        nShrinkCount = 3;
+        break;
+    case RADIX_NODE_48:
+        nShrinkCount = 12;
+        break;
+    case RADIX_NODE_256:
+        nShrinkCount = 40;
+        break;
+    default:
+        break;
+    }
+
+    if (pNode->nChildCount <= nShrinkCount)
+    {
+        std::uint8_t anBytes[256];
+        void *apChildren[256];
+
+        int nCount = CollectChildren(pNode, anBytes, apChildren);
+
+        *iopSlot = CreateRadixNode((RadixNodeType)(pNode->eType - 1), anBytes, apChildren, nCount);
+
+        DeleteRadixNode(pNode);
+    }
+}
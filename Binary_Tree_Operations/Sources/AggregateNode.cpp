@@ -0,0 +1,82 @@
+//-------------------------------------------------------------------
+/**
+ * @file AggregateNode.cpp
+ * @brief Implementation file for the AggregateNode class.
+ * @author Aditya Jedhe
+ * @date 2025-03-19
+ */
+//-------------------------------------------------------------------
+
+// ---------------------------------------------- Local Headers
+#include "AggregateNode.h"
+
+// ---------------------------------------------- System Headers
+#include <algorithm>
+#include <climits>
+
+//-------------------------------------------------------------------
+AggregateNode::AggregateNode(const int inData,
+                             const int inValue) : AugmentedNode(inData),
+                                                  _nValue(inValue),
+                                                  _objSummary{inValue, inValue, inValue, 1}
+{
+}
+
+//-------------------------------------------------------------------
+AggregateNode::~AggregateNode()
+{
+}
+
+//-------------------------------------------------------------------
+int AggregateNode::GetValue() const
+{
+    return _nValue;
+}
+
+//-------------------------------------------------------------------
+void AggregateNode::SetValue(int inValue)
+{
+    _nValue = inValue;
+}
+
+//-------------------------------------------------------------------
+const AggregateNode::Summary &AggregateNode::GetSummary() const
+{
+    return _objSummary;
+}
+
+//-------------------------------------------------------------------
+void AggregateNode::UpdateSummary()
+{
+    _objSummary = Combine(Combine(SummaryOf(GetLeftNode()), SummaryOfValue(this)), SummaryOf(GetRightNode()));
+}
+
+//-------------------------------------------------------------------
+AggregateNode::Summary AggregateNode::SummaryOf(const Node *ipNode)
+{
+    return (nullptr != ipNode) ? static_cast<const AggregateNode *>(ipNode)->_objSummary : Empty();
+}
+
+//-------------------------------------------------------------------
+AggregateNode::Summary AggregateNode::SummaryOfValue(const Node *ipNode)
+{
+    const int nValue = static_cast<const AggregateNode *>(ipNode)->_nValue;
+
+    return {nValue, nValue, nValue, 1};
+}
+
+//-------------------------------------------------------------------
+AggregateNode::Summary AggregateNode::Combine(const Summary &iobjFirst,
+                                              const Summary &iobjSecond)
+{
+    return {iobjFirst.nSum + iobjSecond.nSum,
+            std::min(iobjFirst.nMin, iobjSecond.nMin),
+            std::max(iobjFirst.nMax, iobjSecond.nMax),
+            iobjFirst.nCount + iobjSecond.nCount};
+}
+
+//-------------------------------------------------------------------
+AggregateNode::Summary AggregateNode::Empty()
+{
+    return {0, INT_MAX, INT_MIN, 0};
+}
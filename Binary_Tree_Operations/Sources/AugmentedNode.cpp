@@ -0,0 +1,47 @@
+//-------------------------------------------------------------------
+/**
+ * @file AugmentedNode.cpp
+ * @brief Implementation file for the AugmentedNode class.
+ * @author Aditya Jedhe
+ * @date 2025-03-21
+ */
+//-------------------------------------------------------------------
+
+// ---------------------------------------------- Local Headers
+#include "AugmentedNode.h"
+
+//-------------------------------------------------------------------
+AugmentedNode::AugmentedNode(const int inData) : Node(inData),
+                                                 _nSize(1),
+                                                 _nHeight(0)
+{
+}
+
+//-------------------------------------------------------------------
+AugmentedNode::~AugmentedNode()
+{
+}
+
+//-------------------------------------------------------------------
+int AugmentedNode::GetSize() const
+{
+    return _nSize;
+}
+
+//-------------------------------------------------------------------
+void AugmentedNode::SetSize(int inSize)
+{
+    _nSize = inSize;
+}
+
+//-------------------------------------------------------------------
+int AugmentedNode::GetHeight() const
+{
+    return _nHeight;
+}
+
+//-------------------------------------------------------------------
+void AugmentedNode::SetHeight(int inHeight)
+{
+    _nHeight = inHeight;
+}
@@ -0,0 +1,740 @@
+//-------------------------------------------------------------------
+/**
+ * @file BPlusTree.cpp
+ * @brief Implementation file for the BPlusTree class.
+ * @author Aditya Jedhe
+ * @date 2025-03-13
+ */
+//-------------------------------------------------------------------
+
+// ---------------------------------------------- Local Headers
+#include "BPlusTree.h"
+
+// ---------------------------------------------- System Headers
+#include <algorithm>
+#include <bit>
+#include <climits>
+#include <iostream>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+//-------------------------------------------------------------------
+BPlusTree *BPlusTree::CreateBPlusTree()
+{
+    return new BPlusTree;
+}
+
+//-------------------------------------------------------------------
+void BPlusTree::RemoveBPlusTree(BPlusTree *&iopBPlusTree)
+{
+    delete iopBPlusTree;
+    iopBPlusTree = nullptr;
+}
+
+//-------------------------------------------------------------------
+bool BPlusTree::IsEmpty()
+{
+    bool bEmpty(false);
+
+    if (0 == _nDataCount)
+    {
+        std::cout << "ERR<<Tree is empty.>>" << std::endl;
+        bEmpty = true;
+    }
+
+    return bEmpty;
+}
+
+//-------------------------------------------------------------------
+void BPlusTree::InsertNodeInBinarySearchTree(int inData)
+{
+    if (nullptr == _pRootNode)
+    {
+        LeafNode *pLeafNode = new LeafNode{};
+
+        std::fill(pLeafNode->anKeys, pLeafNode->anKeys + _nMaxKeyCount, INT_MAX);
+
+        _pRootNode = pLeafNode;
+        _pFirstLeafNode = pLeafNode;
+        _nInnerLevels = 0;
+    }
+
+    InnerNode *apPath[_nMaxInnerLevels];
+    int anPathIdx[_nMaxInnerLevels];
+
+    LeafNode *pLeafNode = FindLeafNode(inData, apPath, anPathIdx);
+
+    int nPos = CountKeysBelow(pLeafNode->anKeys, pLeafNode->nKeyCount, inData, false);
+
+    ++_nDataCount;
+
+    if ((nPos < pLeafNode->nKeyCount) && (pLeafNode->anKeys[nPos] == inData))
+    {
+        ++pLeafNode->anCounts[nPos];
+        return;
+    }
+
+    if (pLeafNode->nKeyCount < _nMaxKeyCount)
+    {
+        std::copy_backward(pLeafNode->anKeys + nPos,
+                           pLeafNode->anKeys + pLeafNode->nKeyCount,
+                           pLeafNode->anKeys + pLeafNode->nKeyCount + 1);
+        std::copy_backward(pLeafNode->anCounts + nPos,
+                           pLeafNode->anCounts + pLeafNode->nKeyCount,
+                           pLeafNode->anCounts + pLeafNode->nKeyCount + 1);
+
+        pLeafNode->anKeys[nPos] = inData;
+        pLeafNode->anCounts[nPos] = 1;
+        ++pLeafNode->nKeyCount;
+
+        return;
+    }
+
+    /**
+     * Split the full leaf: the 16 data are shared 8 and 8 and the
+     * first data of the new right leaf separates the two
+     */
+    int anKeys[_nMaxKeyCount + 1];
+    int anCounts[_nMaxKeyCount + 1];
+
+    std::copy(pLeafNode->anKeys, pLeafNode->anKeys + nPos, anKeys);
+    std::copy(pLeafNode->anCounts, pLeafNode->anCounts + nPos, anCounts);
+
+    anKeys[nPos] = inData;
+    anCounts[nPos] = 1;
+
+    std::copy(pLeafNode->anKeys + nPos, pLeafNode->anKeys + _nMaxKeyCount, anKeys + nPos + 1);
+    std::copy(pLeafNode->anCounts + nPos, pLeafNode->anCounts + _nMaxKeyCount, anCounts + nPos + 1);
+
+    const int nLeftCount = (_nMaxKeyCount + 1) / 2;
+
+    LeafNode *pRightLeafNode = new LeafNode{};
+
+    std::fill(pLeafNode->anKeys, pLeafNode->anKeys + _nMaxKeyCount, INT_MAX);
+    std::fill(pRightLeafNode->anKeys, pRightLeafNode->anKeys + _nMaxKeyCount, INT_MAX);
+
+    std::copy(anKeys, anKeys + nLeftCount, pLeafNode->anKeys);
+    std::copy(anCounts, anCounts + nLeftCount, pLeafNode->anCounts);
+    pLeafNode->nKeyCount = nLeftCount;
+
+    std::copy(anKeys + nLeftCount, anKeys + _nMaxKeyCount + 1, pRightLeafNode->anKeys);
+    std::copy(anCounts + nLeftCount, anCounts + _nMaxKeyCount + 1, pRightLeafNode->anCounts);
+    pRightLeafNode->nKeyCount = _nMaxKeyCount + 1 - nLeftCount;
+
+    pRightLeafNode->pNextLeafNode = pLeafNode->pNextLeafNode;
+    pLeafNode->pNextLeafNode = pRightLeafNode;
+
+    InsertIntoInnerNode(apPath, anPathIdx, _nInnerLevels - 1, pRightLeafNode->anKeys[0], pRightLeafNode);
+}
+
+//-------------------------------------------------------------------
+void BPlusTree::DeleteBinaryTreeNode(int inData)
+{
+    if (IsEmpty())
+    {
+        return;
+    }
+
+    InnerNode *apPath[_nMaxInnerLevels];
+    int anPathIdx[_nMaxInnerLevels];
+
+    LeafNode *pLeafNode = FindLeafNode(inData, apPath, anPathIdx);
+
+    int nPos = CountKeysBelow(pLeafNode->anKeys, pLeafNode->nKeyCount, inData, false);
+
+    if ((nPos >= pLeafNode->nKeyCount) || (pLeafNode->anKeys[nPos] != inData))
+    {
+        std::cout << "Node is not found for the given data." << std::endl;
+        return;
+    }
+
+    --_nDataCount;
+
+    if (1 < pLeafNode->anCounts[nPos])
+    {
+        --pLeafNode->anCounts[nPos];
+        return;
+    }
+
+    std::copy(pLeafNode->anKeys + nPos + 1, pLeafNode->anKeys + pLeafNode->nKeyCount, pLeafNode->anKeys + nPos);
+    std::copy(pLeafNode->anCounts + nPos + 1, pLeafNode->anCounts + pLeafNode->nKeyCount, pLeafNode->anCounts + nPos);
+
+    --pLeafNode->nKeyCount;
+    pLeafNode->anKeys[pLeafNode->nKeyCount] = INT_MAX;
+
+    if (0 == _nInnerLevels)
+    {
+        /**
+         * The root leaf may hold any number of data, it is only freed
+         * once empty
+         */
+        if (0 == pLeafNode->nKeyCount)
+        {
+            delete pLeafNode;
+
+            _pRootNode = nullptr;
+            _pFirstLeafNode = nullptr;
+        }
+
+        return;
+    }
+
+    if (_nMinKeyCount > pLeafNode->nKeyCount)
+    {
+        RefillLeafNode(apPath, anPathIdx);
+    }
+}
+
+//-------------------------------------------------------------------
+bool BPlusTree::SearchInBinaryTree(int inData)
+{
+    if (nullptr == _pRootNode)
+    {
+        return false;
+    }
+
+    LeafNode *pLeafNode = FindLeafNode(inData, nullptr, nullptr);
+
+    int nPos = CountKeysBelow(pLeafNode->anKeys, pLeafNode->nKeyCount, inData, false);
+
+    return (nPos < pLeafNode->nKeyCount) && (pLeafNode->anKeys[nPos] == inData);
+}
+
+//-------------------------------------------------------------------
+void BPlusTree::InOrderTraversal(bool ibExpandDuplicates)
+{
+    if (IsEmpty())
+    {
+        return;
+    }
+
+    std::cout << "In order traversal: ";
+
+    for (LeafNode *pLeafNode = _pFirstLeafNode; nullptr != pLeafNode; pLeafNode = pLeafNode->pNextLeafNode)
+    {
+        for (int nIdx = 0; nIdx < pLeafNode->nKeyCount; ++nIdx)
+        {
+            if (ibExpandDuplicates)
+            {
+                for (int nCount = 0; nCount < pLeafNode->anCounts[nIdx]; ++nCount)
+                {
+                    std::cout << pLeafNode->anKeys[nIdx] << " ";
+                }
+            }
+            else if (1 < pLeafNode->anCounts[nIdx])
+            {
+                std::cout << pLeafNode->anKeys[nIdx] << "x" << pLeafNode->anCounts[nIdx] << " ";
+            }
+            else
+            {
+                std::cout << pLeafNode->anKeys[nIdx] << " ";
+            }
+        }
+    }
+
+    std::cout << std::endl;
+}
+
+//-------------------------------------------------------------------
+void BPlusTree::LevelOrderTraversal()
+{
+    if (IsEmpty())
+    {
+        return;
+    }
+
+    std::cout << "Level order traversal: ";
+
+    std::vector<void *> vNodes(1, _pRootNode);
+    std::vector<void *> vNextNodes;
+
+    for (int nLevel = 0; nLevel < _nInnerLevels; ++nLevel)
+    {
+        vNextNodes.clear();
+
+        for (auto pNode : vNodes)
+        {
+            InnerNode *pInnerNode = static_cast<InnerNode *>(pNode);
+
+            std::cout << "[";
+
+            for (int nIdx = 0; nIdx < pInnerNode->nKeyCount; ++nIdx)
+            {
+                std::cout << ((0 == nIdx) ? "" : " ") << pInnerNode->anKeys[nIdx];
+            }
+
+            std::cout << "] ";
+
+            vNextNodes.insert(vNextNodes.end(),
+                              pInnerNode->apChildNodes,
+                              pInnerNode->apChildNodes + pInnerNode->nKeyCount + 1);
+        }
+
+        std::swap(vNodes, vNextNodes);
+    }
+
+    for (auto pNode : vNodes)
+    {
+        LeafNode *pLeafNode = static_cast<LeafNode *>(pNode);
+
+        std::cout << "[";
+
+        for (int nIdx = 0; nIdx < pLeafNode->nKeyCount; ++nIdx)
+        {
+            std::cout << ((0 == nIdx) ? "" : " ") << pLeafNode->anKeys[nIdx];
+        }
+
+        std::cout << "] ";
+    }
+
+    std::cout << std::endl;
+}
+
+//-------------------------------------------------------------------
+void BPlusTree::RetrieveInOrderData(std::vector<int> &iovData,
+                                    bool ibExpandDuplicates)
+{
+    for (LeafNode *pLeafNode = _pFirstLeafNode; nullptr != pLeafNode; pLeafNode = pLeafNode->pNextLeafNode)
+    {
+        for (int nIdx = 0; nIdx < pLeafNode->nKeyCount; ++nIdx)
+        {
+            iovData.insert(iovData.end(), ibExpandDuplicates ? pLeafNode->anCounts[nIdx] : 1, pLeafNode->anKeys[nIdx]);
+        }
+    }
+}
+
+//-------------------------------------------------------------------
+int BPlusTree::HeightOfBinaryTree()
+{
+    return (nullptr == _pRootNode) ? -1 : _nInnerLevels;
+}
+
+//===================================================================
+// Private Methods: Implementation
+//===================================================================
+
+//-------------------------------------------------------------------
+BPlusTree::BPlusTree() : _pRootNode(nullptr),
+                         _pFirstLeafNode(nullptr),
+                         _nInnerLevels(0),
+                         _nDataCount(0)
+{
+}
+
+//-------------------------------------------------------------------
+BPlusTree::~BPlusTree()
+{
+    if (nullptr == _pRootNode)
+    {
+        return;
+    }
+
+    std::vector<void *> vNodes(1, _pRootNode);
+    std::vector<void *> vNextNodes;
+
+    for (int nLevel = 0; nLevel < _nInnerLevels; ++nLevel)
+    {
+        vNextNodes.clear();
+
+        for (auto pNode : vNodes)
+        {
+            InnerNode *pInnerNode = static_cast<InnerNode *>(pNode);
+
+            vNextNodes.insert(vNextNodes.end(),
+                              pInnerNode->apChildNodes,
+                              pInnerNode->apChildNodes + pInnerNode->nKeyCount + 1);
+
+            delete pInnerNode;
+        }
+
+        std::swap(vNodes, vNextNodes);
+    }
+
+    for (auto pNode : vNodes)
+    {
+        delete static_cast<LeafNode *>(pNode);
+    }
+
+    _pRootNode = nullptr;
+    _pFirstLeafNode = nullptr;
+}
+
+//-------------------------------------------------------------------
+int BPlusTree::CountKeysBelow(const int *ipKeys,
+                              int inKeyCount,
+                              int inData,
+                              bool ibInclusive)
+{
+    unsigned int nMask(0);
+
+#if defined(__AVX2__)
+    const __m256i objData = _mm256_set1_epi32(inData);
+    const __m256i objLowKeys = _mm256_load_si256(reinterpret_cast<const __m256i *>(ipKeys));
+    const __m256i objHighKeys = _mm256_load_si256(reinterpret_cast<const __m256i *>(ipKeys + 8));
+
+    /**
+     * key < data is data > key, key <= data is not key > data
+     */
+    __m256i objLow = ibInclusive ? _mm256_cmpgt_epi32(objLowKeys, objData) : _mm256_cmpgt_epi32(objData, objLowKeys);
+    __m256i objHigh = ibInclusive ? _mm256_cmpgt_epi32(objHighKeys, objData) : _mm256_cmpgt_epi32(objData, objHighKeys);
+
+    nMask = (unsigned int)(_mm256_movemask_ps(_mm256_castsi256_ps(objLow))) |
+            ((unsigned int)(_mm256_movemask_ps(_mm256_castsi256_ps(objHigh))) << 8);
+#elif defined(__SSE2__)
+    const __m128i objData = _mm_set1_epi32(inData);
+
+    for (int nQuarter = 0; nQuarter < 4; ++nQuarter)
+    {
+        const __m128i objKeys = _mm_load_si128(reinterpret_cast<const __m128i *>(ipKeys + (4 * nQuarter)));
+
+        /**
+         * key < data is data > key, key <= data is not key > data
+         */
+        __m128i objCompare = ibInclusive ? _mm_cmpgt_epi32(objKeys, objData) : _mm_cmpgt_epi32(objData, objKeys);
+
+        nMask |= (unsigned int)(_mm_movemask_ps(_mm_castsi128_ps(objCompare))) << (4 * nQuarter);
+    }
+#else
+    for (int nIdx = 0; nIdx < _nMaxKeyCount; ++nIdx)
+    {
+        bool bSet = ibInclusive ? (ipKeys[nIdx] > inData) : (inData > ipKeys[nIdx]);
+
+        nMask |= (unsigned int)(bSet) << nIdx;
+    }
+#endif
+
+    if (ibInclusive)
+    {
+        nMask = ~nMask;
+    }
+
+    return std::popcount(nMask & ((1u << inKeyCount) - 1));
+}
+
+//-------------------------------------------------------------------
+BPlusTree::LeafNode *BPlusTree::FindLeafNode(int inData,
+                                             InnerNode **oapPath,
+                                             int *oanPathIdx)
+{
+    void *pNode = _pRootNode;
+
+    for (int nLevel = 0; nLevel < _nInnerLevels; ++nLevel)
+    {
+        InnerNode *pInnerNode = static_cast<InnerNode *>(pNode);
+
+        /**
+         * Both lines of child pointers are loaded while the data
+         * line is compared
+         */
+        __builtin_prefetch(pInnerNode->apChildNodes);
+        __builtin_prefetch(pInnerNode->apChildNodes + 8);
+
+        int nIdx = CountKeysBelow(pInnerNode->anKeys, pInnerNode->nKeyCount, inData, true);
+
+        if (nullptr != oapPath)
+        {
+            oapPath[nLevel] = pInnerNode;
+            oanPathIdx[nLevel] = nIdx;
+        }
+
+        pNode = pInnerNode->apChildNodes[nIdx];
+    }
+
+    return static_cast<LeafNode *>(pNode);
+}
+
+//-------------------------------------------------------------------
+void BPlusTree::InsertIntoInnerNode(InnerNode **iapPath,
+                                    int *ianPathIdx,
+                                    int inLevel,
+                                    int inKey,
+                                    void *ipRightNode)
+{
+    if (0 > inLevel)
+    {
+        /**
+         * The root node was split, the tree grows by one level
+         */
+        InnerNode *pRootNode = new InnerNode{};
+
+        std::fill(pRootNode->anKeys, pRootNode->anKeys + _nMaxKeyCount, INT_MAX);
+
+        pRootNode->anKeys[0] = inKey;
+        pRootNode->nKeyCount = 1;
+        pRootNode->apChildNodes[0] = _pRootNode;
+        pRootNode->apChildNodes[1] = ipRightNode;
+
+        _pRootNode = pRootNode;
+        ++_nInnerLevels;
+
+        return;
+    }
+
+    InnerNode *pInnerNode = iapPath[inLevel];
+    int nPos = ianPathIdx[inLevel];
+
+    if (pInnerNode->nKeyCount < _nMaxKeyCount)
+    {
+        std::copy_backward(pInnerNode->anKeys + nPos,
+                           pInnerNode->anKeys + pInnerNode->nKeyCount,
+                           pInnerNode->anKeys + pInnerNode->nKeyCount + 1);
+        std::copy_backward(pInnerNode->apChildNodes + nPos + 1,
+                           pInnerNode->apChildNodes + pInnerNode->nKeyCount + 1,
+                           pInnerNode->apChildNodes + pInnerNode->nKeyCount + 2);
+
+        pInnerNode->anKeys[nPos] = inKey;
+        pInnerNode->apChildNodes[nPos + 1] = ipRightNode;
+        ++pInnerNode->nKeyCount;
+
+        return;
+    }
+
+    /**
+     * Split the full inner node: of the 16 separating data the
+     * left node keeps 8, the next one moves up and the right node
+     * takes the other 7
+     */
+    int anKeys[_nMaxKeyCount + 1];
+    void *apChildNodes[_nMaxKeyCount + 2];
+
+    std::copy(pInnerNode->anKeys, pInnerNode->anKeys + nPos, anKeys);
+    anKeys[nPos] = inKey;
+    std::copy(pInnerNode->anKeys + nPos, pInnerNode->anKeys + _nMaxKeyCount, anKeys + nPos + 1);
+
+    std::copy(pInnerNode->apChildNodes, pInnerNode->apChildNodes + nPos + 1, apChildNodes);
+    apChildNodes[nPos + 1] = ipRightNode;
+    std::copy(pInnerNode->apChildNodes + nPos + 1, pInnerNode->apChildNodes + _nMaxKeyCount + 1, apChildNodes + nPos + 2);
+
+    const int nLeftCount = (_nMaxKeyCount + 1) / 2;
+
+    InnerNode *pRightInnerNode = new InnerNode{};
+
+    std::fill(pInnerNode->anKeys, pInnerNode->anKeys + _nMaxKeyCount, INT_MAX);
+    std::fill(pRightInnerNode->anKeys, pRightInnerNode->anKeys + _nMaxKeyCount, INT_MAX);
+
+    std::copy(anKeys, anKeys + nLeftCount, pInnerNode->anKeys);
+    std::copy(apChildNodes, apChildNodes + nLeftCount + 1, pInnerNode->apChildNodes);
+    pInnerNode->nKeyCount = nLeftCount;
+
+    std::copy(anKeys + nLeftCount + 1, anKeys + _nMaxKeyCount + 1, pRightInnerNode->anKeys);
+    std::copy(apChildNodes + nLeftCount + 1, apChildNodes + _nMaxKeyCount + 2, pRightInnerNode->apChildNodes);
+    pRightInnerNode->nKeyCount = _nMaxKeyCount - nLeftCount;
+
+    InsertIntoInnerNode(iapPath, ianPathIdx, inLevel - 1, anKeys[nLeftCount], pRightInnerNode);
+}
+
+//-------------------------------------------------------------------
+void BPlusTree::RefillLeafNode(InnerNode **iapPath,
+                               int *ianPathIdx)
+{
+    InnerNode *pParentNode = iapPath[_nInnerLevels - 1];
+    const int nIdx = ianPathIdx[_nInnerLevels - 1];
+
+    LeafNode *pLeafNode = static_cast<LeafNode *>(pParentNode->apChildNodes[nIdx]);
+    LeafNode *pLeftLeafNode = (0 < nIdx) ? static_cast<LeafNode *>(pParentNode->apChildNodes[nIdx - 1]) : nullptr;
+    LeafNode *pRightLeafNode = (nIdx < pParentNode->nKeyCount) ? static_cast<LeafNode *>(pParentNode->apChildNodes[nIdx + 1]) : nullptr;
+
+    if ((nullptr != pLeftLeafNode) && (_nMinKeyCount < pLeftLeafNode->nKeyCount))
+    {
+        /**
+         * The last data of the left sibling moves over and becomes the
+         * separating data
+         */
+        std::copy_backward(pLeafNode->anKeys,
+                           pLeafNode->anKeys + pLeafNode->nKeyCount,
+                           pLeafNode->anKeys + pLeafNode->nKeyCount + 1);
+        std::copy_backward(pLeafNode->anCounts,
+                           pLeafNode->anCounts + pLeafNode->nKeyCount,
+                           pLeafNode->anCounts + pLeafNode->nKeyCount + 1);
+
+        --pLeftLeafNode->nKeyCount;
+
+        pLeafNode->anKeys[0] = pLeftLeafNode->anKeys[pLeftLeafNode->nKeyCount];
+        pLeafNode->anCounts[0] = pLeftLeafNode->anCounts[pLeftLeafNode->nKeyCount];
+        ++pLeafNode->nKeyCount;
+
+        pLeftLeafNode->anKeys[pLeftLeafNode->nKeyCount] = INT_MAX;
+
+        pParentNode->anKeys[nIdx - 1] = pLeafNode->anKeys[0];
+
+        return;
+    }
+
+    if ((nullptr != pRightLeafNode) && (_nMinKeyCount < pRightLeafNode->nKeyCount))
+    {
+        /**
+         * The first data of the right sibling moves over, the next one
+         * becomes the separating data
+         */
+        pLeafNode->anKeys[pLeafNode->nKeyCount] = pRightLeafNode->anKeys[0];
+        pLeafNode->anCounts[pLeafNode->nKeyCount] = pRightLeafNode->anCounts[0];
+        ++pLeafNode->nKeyCount;
+
+        std::copy(pRightLeafNode->anKeys + 1, pRightLeafNode->anKeys + pRightLeafNode->nKeyCount, pRightLeafNode->anKeys);
+        std::copy(pRightLeafNode->anCounts + 1, pRightLeafNode->anCounts + pRightLeafNode->nKeyCount, pRightLeafNode->anCounts);
+
+        --pRightLeafNode->nKeyCount;
+        pRightLeafNode->anKeys[pRightLeafNode->nKeyCount] = INT_MAX;
+
+        pParentNode->anKeys[nIdx] = pRightLeafNode->anKeys[0];
+
+        return;
+    }
+
+    /**
+     * The siblings hold the minimum number of data, so the pair fits
+     * in one leaf: the right leaf of the pair is appended to the left
+     * one and unlinked from the chain of leaves
+     */
+    const int nRightIdx = (nullptr != pLeftLeafNode) ? nIdx : nIdx + 1;
+
+    pLeftLeafNode = static_cast<LeafNode *>(pParentNode->apChildNodes[nRightIdx - 1]);
+    pRightLeafNode = static_cast<LeafNode *>(pParentNode->apChildNodes[nRightIdx]);
+
+    std::copy(pRightLeafNode->anKeys,
+              pRightLeafNode->anKeys + pRightLeafNode->nKeyCount,
+              pLeftLeafNode->anKeys + pLeftLeafNode->nKeyCount);
+    std::copy(pRightLeafNode->anCounts,
+              pRightLeafNode->anCounts + pRightLeafNode->nKeyCount,
+              pLeftLeafNode->anCounts + pLeftLeafNode->nKeyCount);
+
+    pLeftLeafNode->nKeyCount += pRightLeafNode->nKeyCount;
+    pLeftLeafNode->pNextLeafNode = pRightLeafNode->pNextLeafNode;
+
+    delete pRightLeafNode;
+
+    RemoveFromInnerNode(iapPath, ianPathIdx, _nInnerLevels - 1, nRightIdx);
+}
+
+//-------------------------------------------------------------------
+void BPlusTree::RefillInnerNode(InnerNode **iapPath,
+                                int *ianPathIdx,
+                                int inLevel)
+{
+    InnerNode *pParentNode = iapPath[inLevel - 1];
+    const int nIdx = ianPathIdx[inLevel - 1];
+
+    InnerNode *pInnerNode = iapPath[inLevel];
+    InnerNode *pLeftInnerNode = (0 < nIdx) ? static_cast<InnerNode *>(pParentNode->apChildNodes[nIdx - 1]) : nullptr;
+    InnerNode *pRightInnerNode = (nIdx < pParentNode->nKeyCount) ? static_cast<InnerNode *>(pParentNode->apChildNodes[nIdx + 1]) : nullptr;
+
+    if ((nullptr != pLeftInnerNode) && (_nMinKeyCount < pLeftInnerNode->nKeyCount))
+    {
+        /**
+         * Rotate through the parent: the separating data comes down in
+         * front of the node, the last data of the left sibling goes up
+         */
+        std::copy_backward(pInnerNode->anKeys,
+                           pInnerNode->anKeys + pInnerNode->nKeyCount,
+                           pInnerNode->anKeys + pInnerNode->nKeyCount + 1);
+        std::copy_backward(pInnerNode->apChildNodes,
+                           pInnerNode->apChildNodes + pInnerNode->nKeyCount + 1,
+                           pInnerNode->apChildNodes + pInnerNode->nKeyCount + 2);
+
+        pInnerNode->anKeys[0] = pParentNode->anKeys[nIdx - 1];
+        pInnerNode->apChildNodes[0] = pLeftInnerNode->apChildNodes[pLeftInnerNode->nKeyCount];
+        ++pInnerNode->nKeyCount;
+
+        pParentNode->anKeys[nIdx - 1] = pLeftInnerNode->anKeys[pLeftInnerNode->nKeyCount - 1];
+
+        pLeftInnerNode->apChildNodes[pLeftInnerNode->nKeyCount] = nullptr;
+        --pLeftInnerNode->nKeyCount;
+        pLeftInnerNode->anKeys[pLeftInnerNode->nKeyCount] = INT_MAX;
+
+        return;
+    }
+
+    if ((nullptr != pRightInnerNode) && (_nMinKeyCount < pRightInnerNode->nKeyCount))
+    {
+        /**
+         * Rotate through the parent: the separating data comes down at
+         * the end of the node, the first data of the right sibling goes up
+         */
+        pInnerNode->anKeys[pInnerNode->nKeyCount] = pParentNode->anKeys[nIdx];
+        pInnerNode->apChildNodes[pInnerNode->nKeyCount + 1] = pRightInnerNode->apChildNodes[0];
+        ++pInnerNode->nKeyCount;
+
+        pParentNode->anKeys[nIdx] = pRightInnerNode->anKeys[0];
+
+        std::copy(pRightInnerNode->anKeys + 1,
+                  pRightInnerNode->anKeys + pRightInnerNode->nKeyCount,
+                  pRightInnerNode->anKeys);
+        std::copy(pRightInnerNode->apChildNodes + 1,
+                  pRightInnerNode->apChildNodes + pRightInnerNode->nKeyCount + 1,
+                  pRightInnerNode->apChildNodes);
+
+        pRightInnerNode->apChildNodes[pRightInnerNode->nKeyCount] = nullptr;
+        --pRightInnerNode->nKeyCount;
+        pRightInnerNode->anKeys[pRightInnerNode->nKeyCount] = INT_MAX;
+
+        return;
+    }
+
+    /**
+     * The separating data comes down between the data of the pair,
+     * which then fit in the left node
+     */
+    const int nRightIdx = (nullptr != pLeftInnerNode) ? nIdx : nIdx + 1;
+
+    pLeftInnerNode = static_cast<InnerNode *>(pParentNode->apChildNodes[nRightIdx - 1]);
+    pRightInnerNode = static_cast<InnerNode *>(pParentNode->apChildNodes[nRightIdx]);
+
+    pLeftInnerNode->anKeys[pLeftInnerNode->nKeyCount] = pParentNode->anKeys[nRightIdx - 1];
+
+    std::copy(pRightInnerNode->anKeys,
+              pRightInnerNode->anKeys + pRightInnerNode->nKeyCount,
+              pLeftInnerNode->anKeys + pLeftInnerNode->nKeyCount + 1);
+    std::copy(pRightInnerNode->apChildNodes,
+              pRightInnerNode->apChildNodes + pRightInnerNode->nKeyCount + 1,
+              pLeftInnerNode->apChildNodes + pLeftInnerNode->nKeyCount + 1);
+
+    pLeftInnerNode->nKeyCount += 1 + pRightInnerNode->nKeyCount;
+
+    delete pRightInnerNode;
+
+    RemoveFromInnerNode(iapPath, ianPathIdx, inLevel - 1, nRightIdx);
+}
+
+//-------------------------------------------------------------------
+void BPlusTree::RemoveFromInnerNode(InnerNode **iapPath,
+                                    int *ianPathIdx,
+                                    int inLevel,
+                                    int inChildIdx)
+{
+    InnerNode *pInnerNode = iapPath[inLevel];
+
+    std::copy(pInnerNode->anKeys + inChildIdx,
+              pInnerNode->anKeys + pInnerNode->nKeyCount,
+              pInnerNode->anKeys + inChildIdx - 1);
+    std::copy(pInnerNode->apChildNodes + inChildIdx + 1,
+              pInnerNode->apChildNodes + pInnerNode->nKeyCount + 1,
+              pInnerNode->apChildNodes + inChildIdx);
+
+    pInnerNode->apChildNodes[pInnerNode->nKeyCount] = nullptr;
+    --pInnerNode->nKeyCount;
+    pInnerNode->anKeys[pInnerNode->nKeyCount] = INT_MAX;
+
+    if (0 == inLevel)
+    {
+        /**
+         * A root node left with a single child is dropped, the tree
+         * shrinks by one level
+         */
+        if (0 == pInnerNode->nKeyCount)
+        {
+            _pRootNode = pInnerNode->apChildNodes[0];
+            --_nInnerLevels;
+
+            delete pInnerNode;
+        }
+
+        return;
+    }
+
+    if (_nMinKeyCount > pInnerNode->nKeyCount)
+    {
+        RefillInnerNode(iapPath, ianPathIdx, inLevel);
+    }
+}
@@ -8,16 +8,28 @@
 //-------------------------------------------------------------------
 
 // ---------------------------------------------- Local Headers
+#include "AdaptiveRadixTree.h"
+#include "AggregateNode.h"
+#include "AugmentedNode.h"
 #include "BinaryTree.h"
+#include "BloomFilter.h"
+#include "DenseKeyBitmap.h"
+#include "ForkJoinPool.h"
+#include "NodeIndex.h"
 
 // ---------------------------------------------- Project Headers
 #include "Node.h"
 
 // ---------------------------------------------- System Headers
 #include <algorithm>
+#include <bit>
+#include <climits>
+#include <cmath>
 #include <iostream>
 #include <queue>
 #include <thread>
+#include <unordered_map>
+#include <unordered_set>
 
 //-------------------------------------------------------------------
 BinaryTree *BinaryTree::CreateBinaryTree()
@@ -25,20 +37,82 @@ BinaryTree *BinaryTree::CreateBinaryTree()
     return new BinaryTree;
 }
 
+//-------------------------------------------------------------------
+BinaryTree *BinaryTree::CreateBinaryTreeFromPreOrderAndInOrder(const std::vector<int> &ivPreOrder,
+                                                               const std::vector<int> &ivInOrder)
+{
+    return CreateBinaryTreeFromTraversals(ivPreOrder, ivInOrder, false);
+}
+
+//-------------------------------------------------------------------
+BinaryTree *BinaryTree::CreateBinaryTreeFromPostOrderAndInOrder(const std::vector<int> &ivPostOrder,
+                                                                const std::vector<int> &ivInOrder)
+{
+    return CreateBinaryTreeFromTraversals(ivPostOrder, ivInOrder, true);
+}
+
+//-------------------------------------------------------------------
+BinaryTree *BinaryTree::CreateBinarySearchTreeFromSortedStream(std::istream &ioStream,
+                                                               int inCount)
+{
+    if (0 >= inCount)
+    {
+        std::cout << "ERR<<Number of data to read must be positive.>>" << std::endl;
+        return nullptr;
+    }
+
+    BinaryTree *pBinaryTree = CreateBinaryTree();
+
+    bool bValid(true);
+    long long nPreviousData(LLONG_MIN);
+
+    pBinaryTree->_pRootNode = pBinaryTree->BuildBalancedSubBinaryTree(ioStream,
+                                                                      inCount,
+                                                                      nPreviousData,
+                                                                      bValid);
+
+    if (!bValid)
+    {
+        std::cout << "ERR<<Stream ended early or is not sorted.>>" << std::endl;
+
+        delete pBinaryTree;
+        return nullptr;
+    }
+
+    pBinaryTree->_nNodeCount = inCount;
+    pBinaryTree->_bCompleteTree = (1 == inCount);
+
+    pBinaryTree->RebuildDenseKeyBitmap();
+
+    return pBinaryTree;
+}
+
 //-------------------------------------------------------------------
 void BinaryTree::RemoveBinaryTree(BinaryTree *&ipBinaryTree)
 {
-    if ((nullptr == ipBinaryTree) || (ipBinaryTree->IsEmpty()))
+    if (nullptr == ipBinaryTree)
     {
         return;
     }
 
+    /**
+     * An empty binary tree, as left behind by a set operation, only
+     * has its object to free
+     */
     Node *pRootNode = ipBinaryTree->_pRootNode;
 
-    ipBinaryTree->RemoveChildren(pRootNode);
+    if (nullptr != pRootNode)
+    {
+        /**
+         * One level of threads per doubling of the hardware threads
+         */
+        int nParallelDepth = std::bit_width(std::max(std::thread::hardware_concurrency(), 1u)) - 1;
+
+        ipBinaryTree->RemoveChildren(pRootNode, nParallelDepth);
 
-    delete pRootNode;
-    pRootNode = nullptr;
+        delete pRootNode;
+        pRootNode = nullptr;
+    }
 
     delete ipBinaryTree;
     ipBinaryTree = nullptr;
@@ -61,23 +135,58 @@ bool BinaryTree::IsEmpty()
 //-------------------------------------------------------------------
 void BinaryTree::InsertNodeInBinaryTree(int inData)
 {
+    if (BALANCING_NONE != _eBalancingMode)
+    {
+        std::cout << "ERR<<Level-order insertion would break the balanced binary search tree.>>" << std::endl;
+        return;
+    }
+
     /**
      * Create a new node with the data and
      * insert it into the complete binary tree
      * if root node exists, otherwise make it as a root node
      */
-    Node *pNewNode = new Node(inData);
+    Node *pNewNode = CreateNode(inData);
 
     if (nullptr == pNewNode)
     {
         std::cout << "Memory allocation failed" << std::endl;
         return;
     }
-    else if (nullptr == _pRootNode)
+    else if (_bCompleteTree)
     {
-        _pRootNode = pNewNode;
+        /**
+         * The next free position of a complete binary tree is known
+         * from the node count, no need to search for it level by level
+         */
+        if (0 < _nNodeCount)
+        {
+            _bOrderedTree = false;
+
+            DisableOrderStatistics();
+            DisableRangeAggregates();
+            DisableSubtreeHeights();
+        }
+
+        int nSlot = _nNodeCount++;
+
+        Node *pParentNode = LinkNodeAtSlot(pNewNode, nSlot);
+
+        if (nullptr != _pNodeIndex)
+        {
+            _pNodeIndex->Insert(inData, pNewNode, pParentNode, nSlot);
+        }
+
+        NotifyNodeInserted(pNewNode);
+        return;
     }
 
+    _bOrderedTree = false;
+
+    DisableOrderStatistics();
+    DisableRangeAggregates();
+    DisableSubtreeHeights();
+
     bool bNodeInserted(false);
 
     Node *pNode = nullptr;
@@ -122,594 +231,4238 @@ void BinaryTree::InsertNodeInBinaryTree(int inData)
             }
         }
     }
+
+    ++_nNodeCount;
+
+    NotifyNodeInserted(pNewNode);
 }
 
 //-------------------------------------------------------------------
-void BinaryTree::InsertNodeInBinarySearchTree(int inData)
+void BinaryTree::ConcurrentInsertNodeInBinaryTree(int inData)
 {
-    /**
-     * Create a new node with the data
-     * and insert it into the binary search tree
-     */
-    Node *pNewNode = new Node(inData);
-
-    if (nullptr == pNewNode)
+    if (BALANCING_NONE != _eBalancingMode)
     {
+        std::cout << "ERR<<Level-order insertion would break the balanced binary search tree.>>" << std::endl;
         return;
     }
 
-    if (nullptr != _pRootNode)
+    if (!_bCompleteTree)
     {
-        Node *pCurrentNode = _pRootNode;
-        Node *pParentNode = nullptr;
-
-        while (nullptr != pCurrentNode)
-        {
-            pParentNode = pCurrentNode;
-
-            if (inData < pCurrentNode->GetData())
-            {
-                pCurrentNode = pCurrentNode->GetLeftNode();
-            }
-            else
-            {
-                pCurrentNode = pCurrentNode->GetRightNode();
-            }
-        }
-
-        if (inData < pParentNode->GetData())
-        {
-            pParentNode->SetLeftNode(pNewNode);
-        }
-        else
-        {
-            pParentNode->SetRightNode(pNewNode);
-        }
+        std::cout << "ERR<<Concurrent insertion needs a complete binary tree.>>" << std::endl;
+        return;
     }
-    else
+
+    if (nullptr != _pNodeIndex)
     {
-        _pRootNode = pNewNode;
+        std::cout << "ERR<<Concurrent insertion does not maintain the node index.>>" << std::endl;
+        return;
     }
-}
 
-//-------------------------------------------------------------------
-void BinaryTree::DeleteBinaryTreeNode(int inData)
-{
-    if (IsEmpty())
+    if (nullptr != _pRadixIndex)
     {
+        std::cout << "ERR<<Concurrent insertion does not maintain the radix index.>>" << std::endl;
         return;
     }
 
-    std::cout << "Deleting data: " << inData << std::endl;
-}
-
-//-------------------------------------------------------------------
-bool BinaryTree::SearchInBinaryTree(int inData)
-{
-    bool bFound(false);
-
-    std::deque<Node *> dqNodes;
-
-    Node *pNode = SearchInBinaryTree(_pRootNode, inData, dqNodes);
-
-    if (nullptr != pNode)
+    if (IsAugmented())
     {
-        bFound = true;
+        std::cout << "ERR<<Concurrent insertion does not maintain the augmentations of the nodes.>>" << std::endl;
+        return;
     }
 
-    return bFound;
-}
+    Node *pNewNode = CreateNode(inData);
 
-//-------------------------------------------------------------------
-void BinaryTree::PreOrderTraversal()
-{
-    if (IsEmpty())
+    if (nullptr == pNewNode)
     {
+        std::cout << "Memory allocation failed" << std::endl;
         return;
     }
 
-    std::vector<Node *> vNodes;
+    int nSlot = _nNodeCount.fetch_add(1, std::memory_order_relaxed);
 
-    PreOrderTraversalOfBinaryTreeNode(_pRootNode, vNodes);
+    if (0 < nSlot)
+    {
+        std::atomic_ref<bool>(_bOrderedTree).store(false, std::memory_order_relaxed);
+    }
 
-    std::cout << "Pre order traversal: ";
+    if (nullptr != _pBloomFilter)
+    {
+        _pBloomFilter->Insert(inData);
+    }
 
-    for (auto pNode : vNodes)
+    /**
+     * The range cannot be grown while other threads insert, the next
+     * sequential insertion recomputes it
+     */
+    if ((nullptr != _pDenseKeyBitmap) && (_pDenseKeyBitmap->Covers(inData)))
     {
-        if (nullptr != pNode)
-        {
-            std::cout << pNode->GetData() << " ";
-        }
+        _pDenseKeyBitmap->Set(inData);
+    }
+    else
+    {
+        std::atomic_ref<bool>(_bDenseKeysStale).store(true, std::memory_order_relaxed);
     }
 
-    std::cout << std::endl;
+    LinkNodeAtSlot(pNewNode, nSlot);
 }
 
 //-------------------------------------------------------------------
-void BinaryTree::InOrderTraversal()
+void BinaryTree::InsertNodeInBinarySearchTree(int inData)
 {
-    if (IsEmpty())
+    if ((BALANCING_SPLAY == _eBalancingMode) && (nullptr != _pRootNode))
     {
-        return;
-    }
-
-    std::vector<Node *> vNodes;
-
-    InOrderTraversalOfBinaryTreeNode(_pRootNode, vNodes);
+        /**
+         * Splay the neighbour of the data to the root node and put the
+         * new node above it, taking over the sub-binary tree on the
+         * side of the data
+         */
+        _pRootNode = SplayBinarySearchTree(_pRootNode, inData);
+
+        if (_bMultiset && (inData == _pRootNode->GetData()))
+        {
+            _pRootNode->SetCount(_pRootNode->GetCount() + 1);
+            UpdateAugmentation(_pRootNode);
+            return;
+        }
 
-    std::cout << "In order traversal: ";
+        Node *pNewNode = CreateNode(inData);
 
-    for (auto pNode : vNodes)
-    {
-        if (nullptr != pNode)
+        if (nullptr == pNewNode)
         {
-            std::cout << pNode->GetData() << " ";
+            return;
         }
-    }
 
-    std::cout << std::endl;
-}
+        const bool bRight = (inData >= _pRootNode->GetData());
 
-//-------------------------------------------------------------------
-void BinaryTree::PostOrderTraversal()
-{
-    if (IsEmpty())
-    {
-        return;
-    }
+        pNewNode->SetChildNode(bRight, _pRootNode->GetChildNode(bRight));
+        pNewNode->SetChildNode(!bRight, _pRootNode);
 
-    std::vector<Node *> vNodes;
+        _pRootNode->SetChildNode(bRight, nullptr);
 
-    PostOrderTraversalOfBinaryTreeNode(_pRootNode, vNodes);
+        UpdateAugmentation(_pRootNode);
+        UpdateAugmentation(pNewNode);
 
-    std::cout << "Post order traversal: ";
+        _pRootNode = pNewNode;
 
-    for (auto pNode : vNodes)
-    {
-        if (nullptr != pNode)
-        {
-            std::cout << pNode->GetData() << " ";
-        }
+        ++_nNodeCount;
+        InvalidateCompleteTree();
+
+        NotifyNodeInserted(pNewNode);
+        return;
     }
 
-    std::cout << std::endl;
-}
+    /**
+     * Find the parent of the new data in the binary search tree.
+     * In multiset mode a node already holding the data only
+     * counts one more occurrence.
+     * A red-black tree, a scapegoat tree and a treap keep the path
+     * for their rebalancing, an augmented tree to update the
+     * augmentations of the ancestors.
+     */
+    const bool bRedBlack = (BALANCING_RED_BLACK == _eBalancingMode);
+    const bool bScapegoat = (BALANCING_SCAPEGOAT == _eBalancingMode);
+    const bool bTreap = (BALANCING_TREAP == _eBalancingMode);
 
-//-------------------------------------------------------------------
-void BinaryTree::LevelOrderTraversal()
-{
-    if (IsEmpty())
+    std::vector<Node *> vPath;
+
+    /**
+     * Rotations and rebuilds move the nodes of the finger path
+     */
+    if (BALANCING_NONE != _eBalancingMode)
     {
-        return;
+        ClearFingerPath();
     }
 
-    std::vector<Node *> vNodes;
+    Node *pCurrentNode = _pRootNode;
+    Node *pParentNode = nullptr;
 
-    LevelOrderTraversalOfBinaryTreeNode(_pRootNode, vNodes);
+    while (nullptr != pCurrentNode)
+    {
+        if (_bMultiset && (inData == pCurrentNode->GetData()))
+        {
+            pCurrentNode->SetCount(pCurrentNode->GetCount() + 1);
 
-    std::cout << "Level order traversal: ";
+            UpdateAugmentation(pCurrentNode);
+            UpdateAugmentations(vPath);
+            return;
+        }
 
-    for (auto pNode : vNodes)
-    {
-        if (nullptr != pNode)
+        pParentNode = pCurrentNode;
+
+        if (bRedBlack || bScapegoat || bTreap || IsAugmented())
         {
-            std::cout << pNode->GetData() << " ";
+            vPath.push_back(pCurrentNode);
         }
+
+        pCurrentNode = pCurrentNode->GetChildNode(inData >= pCurrentNode->GetData());
     }
 
-    std::cout << std::endl;
-}
+    Node *pNewNode = CreateNode(inData);
 
-//-------------------------------------------------------------------
-void BinaryTree::ReverseLevelOrderTraversal()
-{
-    if (IsEmpty())
+    if (nullptr == pNewNode)
     {
         return;
     }
 
-    std::deque<Node *> dqNodes;
+    if (nullptr == pParentNode)
+    {
+        _pRootNode = pNewNode;
+    }
+    else
+    {
+        pParentNode->SetChildNode(inData >= pParentNode->GetData(), pNewNode);
+    }
 
-    ReverseLevelOrderTraversalOfBinaryTreeNode(_pRootNode, dqNodes);
+    UpdateAugmentations(vPath);
 
-    std::cout << "Reverse-level order traversal: ";
+    int nIntactCount(0);
 
-    Node *pNode = nullptr;
+    if (bRedBlack)
+    {
+        RebalanceAfterRedBlackInsertion(pNewNode, vPath, nIntactCount);
+    }
+    else if (bTreap)
+    {
+        RebalanceAfterTreapInsertion(pNewNode, vPath, nIntactCount);
+    }
 
-    while (!dqNodes.empty())
+    if (0 < _nNodeCount++)
     {
-        pNode = dqNodes.front();
+        InvalidateCompleteTree();
+    }
 
-        dqNodes.pop_front();
+    if (bScapegoat)
+    {
+        _nMaxNodeCount = std::max<int>(_nMaxNodeCount, _nNodeCount);
 
-        if (nullptr != pNode)
+        if ((double)(vPath.size()) > (std::log((double)(_nNodeCount)) / std::log(1.5)))
         {
-            std::cout << pNode->GetData() << " ";
+            RebuildAtScapegoat(pNewNode, vPath);
         }
     }
 
-    std::cout << std::endl;
+    /**
+     * Rotations and rebuilds keep the sizes and summaries of the nodes
+     * above them, not their heights. Every node moved is up to date,
+     * so the path can be recomputed in its former order.
+     */
+    if (_bSubtreeHeights && (bRedBlack || bScapegoat || bTreap))
+    {
+        UpdateAugmentations(vPath);
+    }
+
+    NotifyNodeInserted(pNewNode);
 }
 
 //-------------------------------------------------------------------
-void BinaryTree::SpiralOrderTraversal()
+void BinaryTree::InsertNodeInBinarySearchTreeFromFinger(int inData)
 {
-    if (IsEmpty())
+    const bool bRedBlack = (BALANCING_RED_BLACK == _eBalancingMode);
+    const bool bTreap = (BALANCING_TREAP == _eBalancingMode);
+
+    /**
+     * A splay tree restructures the whole search path and a scapegoat
+     * tree may rebuild any ancestor, both are descended from the root
+     * node
+     */
+    if ((nullptr == _pRootNode) || ((BALANCING_NONE != _eBalancingMode) && (!bRedBlack) && (!bTreap)))
     {
+        InsertNodeInBinarySearchTree(inData);
+
+        ClearFingerPath();
         return;
     }
 
-    std::vector<Node *> vNodes;
+    if (_vFingerPath.empty() || (_pRootNode != _vFingerPath.front()))
+    {
+        _vFingerPath.assign(1, _pRootNode);
+        _vFingerRanges.assign(1, {LLONG_MIN, LLONG_MAX});
+    }
 
-    SpiralOrderTraversalOfBinaryTreeNode(_pRootNode, vNodes);
+    /**
+     * Climb until the sub-binary tree of the finger may hold the data.
+     * The root node always can, so the path never gets empty.
+     * In multiset mode the data must also differ from the lower bound,
+     * which is held by an ancestor.
+     */
+    while ((1 < _vFingerPath.size()) &&
+           ((inData < _vFingerRanges.back().nLowerBound) ||
+            (_bMultiset && (inData == _vFingerRanges.back().nLowerBound)) ||
+            (inData >= _vFingerRanges.back().nUpperBound)))
+    {
+        _vFingerPath.pop_back();
+        _vFingerRanges.pop_back();
+    }
 
-    std::cout << "Spiral-level order traversal: ";
+    Node *pNode = _vFingerPath.back();
 
-    for (auto pNode : vNodes)
+    while (true)
     {
-        if (nullptr != pNode)
+        if (_bMultiset && (inData == pNode->GetData()))
         {
-            std::cout << pNode->GetData() << " ";
+            pNode->SetCount(pNode->GetCount() + 1);
+
+            UpdateFingerPathAugmentations();
+            return;
+        }
+
+        Node *pNextNode = pNode->GetChildNode(inData >= pNode->GetData());
+
+        if (nullptr == pNextNode)
+        {
+            break;
         }
+
+        DescendFingerPath(pNextNode);
+
+        pNode = pNextNode;
     }
 
-    std::cout << std::endl;
-}
+    Node *pNewNode = CreateNode(inData);
 
-//-------------------------------------------------------------------
-void BinaryTree::PrintLeafNodes()
-{
-    if (IsEmpty())
+    if (nullptr == pNewNode)
     {
         return;
     }
 
-    std::vector<Node *> vNodes;
+    pNode->SetChildNode(inData >= pNode->GetData(), pNewNode);
 
-    RetrieveLeafNodesOfBinaryTreeNode(_pRootNode, vNodes);
+    /**
+     * The finger path leads to the parent of the new node, so the
+     * rebalancing walks it up as the path of any other insertion
+     */
+    UpdateFingerPathAugmentations();
 
-    std::cout << "Leaf nodes: ";
+    int nIntactCount = (int)(_vFingerPath.size());
 
-    for (auto pNode : vNodes)
+    if (bRedBlack)
     {
-        if (nullptr != pNode)
-        {
-            std::cout << pNode->GetData() << " ";
+        RebalanceAfterRedBlackInsertion(pNewNode, _vFingerPath, nIntactCount);
+    }
+    else if (bTreap)
+    {
+        RebalanceAfterTreapInsertion(pNewNode, _vFingerPath, nIntactCount);
+    }
+
+    /**
+     * Rotations keep the sizes and summaries of the nodes above them,
+     * not their heights
+     */
+    if (_bSubtreeHeights && (nIntactCount < (int)(_vFingerPath.size())))
+    {
+        UpdateFingerPathAugmentations();
+    }
+
+    /**
+     * The nodes above the highest rotation are still the ancestors of
+     * the new node, the finger descends again from the last of them
+     */
+    if (0 == nIntactCount)
+    {
+        _vFingerPath.assign(1, _pRootNode);
+        _vFingerRanges.assign(1, {LLONG_MIN, LLONG_MAX});
+    }
+    else
+    {
+        _vFingerPath.resize(nIntactCount);
+        _vFingerRanges.resize(nIntactCount);
+    }
+
+    for (pNode = _vFingerPath.back(); pNewNode != pNode;)
+    {
+        pNode = pNode->GetChildNode(inData >= pNode->GetData());
+
+        DescendFingerPath(pNode);
+    }
+
+    ++_nNodeCount;
+    InvalidateCompleteTree();
+
+    NotifyNodeInserted(pNewNode);
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::SetMultisetMode(bool ibMultiset)
+{
+    _bMultiset = ibMultiset;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::SetBranchlessSearch(bool ibBranchless)
+{
+    _bBranchlessSearch = ibBranchless;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::SetBalancingMode(BalancingMode ieMode)
+{
+    if (nullptr != _pRootNode)
+    {
+        std::cout << "ERR<<Balancing mode can only be changed on an empty binary tree.>>" << std::endl;
+        return;
+    }
+
+    _eBalancingMode = ieMode;
+    _nMaxNodeCount = 0;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::DeleteBinaryTreeNode(int inData)
+{
+    if (IsEmpty())
+    {
+        return;
+    }
+
+    Node *pParentNode = nullptr;
+    int nDepth(0);
+
+    Node *pNode = LocateNode(inData, pParentNode, nDepth);
+
+    if (nullptr == pNode)
+    {
+        std::cout << "Node is not found for the given data." << std::endl;
+        return;
+    }
+
+    /**
+     * The rebalancing of a red-black tree walks back up the ancestors
+     * of the node, and so do the updates of the augmentations
+     */
+    std::vector<Node *> vPath;
+
+    if ((BALANCING_RED_BLACK == _eBalancingMode) || IsAugmented())
+    {
+        pNode = SearchInBinaryTree(_pRootNode, inData, vPath);
+        pParentNode = vPath.empty() ? nullptr : vPath.back();
+    }
+
+    if (1 < pNode->GetCount())
+    {
+        pNode->SetCount(pNode->GetCount() - 1);
+
+        UpdateAugmentation(pNode);
+        UpdateAugmentations(vPath);
+        return;
+    }
+
+    if (BALANCING_RED_BLACK == _eBalancingMode)
+    {
+        InvalidateCompleteTree();
+
+        RemoveNodeFromRedBlackTree(pNode, vPath);
+
+        /**
+         * The rotations change the heights of the nodes above them
+         */
+        if (_bSubtreeHeights)
+        {
+            UpdateAugmentations(vPath);
+        }
+    }
+    else if (BALANCING_SPLAY == _eBalancingMode)
+    {
+        InvalidateCompleteTree();
+
+        _pRootNode = SplayBinarySearchTree(_pRootNode, inData);
+
+        pNode = _pRootNode;
+
+        RemoveNodeFromBinarySearchTree(pNode, nullptr);
+    }
+    else if (BALANCING_TREAP == _eBalancingMode)
+    {
+        InvalidateCompleteTree();
+
+        ReplaceChild(pParentNode, pNode, JoinTreap(pNode->GetLeftNode(), pNode->GetRightNode()));
+
+        UpdateAugmentations(vPath);
+    }
+    else if (_bOrderedTree)
+    {
+        InvalidateCompleteTree();
+
+        RemoveNodeFromBinarySearchTree(pNode, pParentNode);
+
+        UpdateAugmentations(vPath);
+    }
+    else
+    {
+        RemoveNodeFromBinaryTree(pNode, pParentNode, nDepth);
+    }
+
+    if (0 == --_nNodeCount)
+    {
+        _bCompleteTree = true;
+        _bOrderedTree = true;
+    }
+
+    if ((BALANCING_SCAPEGOAT == _eBalancingMode) && ((3 * _nNodeCount) < (2 * _nMaxNodeCount)))
+    {
+        _pRootNode = RebuildSubBinarySearchTree(_pRootNode);
+        _nMaxNodeCount = _nNodeCount;
+    }
+
+    ClearFingerPath();
+
+    NotifyDataRemoved(inData, pNode);
+
+    delete pNode;
+    pNode = nullptr;
+}
+
+//-------------------------------------------------------------------
+BinaryTree *BinaryTree::Split(int inData)
+{
+    if (!_bOrderedTree)
+    {
+        std::cout << "ERR<<Split needs a binary search tree.>>" << std::endl;
+        return nullptr;
+    }
+
+    BinaryTree *pBinaryTree = CreateBinaryTree();
+
+    pBinaryTree->_eBalancingMode = _eBalancingMode;
+    pBinaryTree->_bMultiset = _bMultiset;
+    pBinaryTree->_bBranchlessSearch = _bBranchlessSearch;
+    pBinaryTree->_bSubtreeSizes = _bSubtreeSizes;
+    pBinaryTree->_bRangeAggregates = _bRangeAggregates;
+    pBinaryTree->_bSubtreeHeights = _bSubtreeHeights;
+    pBinaryTree->_bAugmentedNodes = _bAugmentedNodes;
+
+    Node *pLNode = nullptr;
+    Node *pRNode = nullptr;
+
+    if (BALANCING_RED_BLACK == _eBalancingMode)
+    {
+        SplitRedBlackTree(_pRootNode, inData, pLNode, pRNode);
+    }
+    else
+    {
+        /**
+         * A splay tree first brings the search path up to the root
+         * node, so the split walks a short path
+         */
+        if ((BALANCING_SPLAY == _eBalancingMode) && (nullptr != _pRootNode))
+        {
+            _pRootNode = SplayBinarySearchTree(_pRootNode, inData);
+        }
+
+        SplitSubBinarySearchTree(_pRootNode, inData, false, pLNode, pRNode);
+    }
+
+    /**
+     * The sizes count the nodes unless a node holds several
+     * occurrences
+     */
+    const int nMovedCount = (_bSubtreeSizes && (!_bMultiset)) ? RetrieveSubtreeSize(pRNode) : CountNodesOfFirstSubBinaryTree(pRNode, pLNode, _nNodeCount);
+
+    _pRootNode = pLNode;
+    _nNodeCount -= nMovedCount;
+    ResetDerivedState();
+
+    pBinaryTree->_pRootNode = pRNode;
+    pBinaryTree->_nNodeCount = nMovedCount;
+    pBinaryTree->ResetDerivedState();
+
+    if (nullptr != _pBloomFilter)
+    {
+        pBinaryTree->EnableBloomFilter(nMovedCount, _pBloomFilter->FalsePositiveRate());
+    }
+
+    if (nullptr != _pRadixIndex)
+    {
+        pBinaryTree->EnableRadixIndex();
+    }
+
+    return pBinaryTree;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::Join(BinaryTree *&iopBinaryTree)
+{
+    if (!IsCompatibleOperand(iopBinaryTree))
+    {
+        return;
+    }
+
+    Node *pOtherRootNode = iopBinaryTree->_pRootNode;
+
+    if ((nullptr == _pRootNode) || (nullptr == pOtherRootNode))
+    {
+        AdoptBinaryTree((nullptr != _pRootNode) ? _pRootNode : pOtherRootNode,
+                        _nNodeCount + iopBinaryTree->_nNodeCount,
+                        iopBinaryTree);
+        return;
+    }
+
+    /**
+     * Only the extreme nodes are compared, so the order of both
+     * binary trees is found in O(depth)
+     */
+    Node *apExtremeNodes[2][2];
+
+    for (int nTree = 0; nTree < 2; ++nTree)
+    {
+        for (int nSide = 0; nSide < 2; ++nSide)
+        {
+            Node *pNode = (0 == nTree) ? _pRootNode : pOtherRootNode;
+
+            while (nullptr != pNode->GetChildNode(1 == nSide))
+            {
+                pNode = pNode->GetChildNode(1 == nSide);
+            }
+
+            apExtremeNodes[nTree][nSide] = pNode;
+        }
+    }
+
+    BinaryTree *pLeftBinaryTree = nullptr;
+    BinaryTree *pRightBinaryTree = nullptr;
+
+    if (apExtremeNodes[0][1]->GetData() < apExtremeNodes[1][0]->GetData())
+    {
+        pLeftBinaryTree = this;
+        pRightBinaryTree = iopBinaryTree;
+    }
+    else if (apExtremeNodes[1][1]->GetData() < apExtremeNodes[0][0]->GetData())
+    {
+        pLeftBinaryTree = iopBinaryTree;
+        pRightBinaryTree = this;
+    }
+    else
+    {
+        std::cout << "ERR<<Ranges of data of the binary trees overlap.>>" << std::endl;
+        return;
+    }
+
+    const int nNodeCount = _nNodeCount + iopBinaryTree->_nNodeCount;
+
+    Node *pRootNode = nullptr;
+
+    switch (_eBalancingMode)
+    {
+    case BALANCING_TREAP:
+        pRootNode = JoinTreap(pLeftBinaryTree->_pRootNode, pRightBinaryTree->_pRootNode);
+        break;
+
+    case BALANCING_RED_BLACK:
+    {
+        /**
+         * The smallest node of the right binary tree is taken out to
+         * link both red-black trees below it
+         */
+        Node *pMiddleNode = pRightBinaryTree->DetachSmallestRedBlackNode();
+        Node *pRNode = pRightBinaryTree->_pRootNode;
+        Node *pLNode = pLeftBinaryTree->_pRootNode;
+
+        int nBlackHeight(0);
+
+        pRootNode = JoinRedBlackTrees(pLNode, RetrieveBlackHeight(pLNode), pMiddleNode, pRNode, RetrieveBlackHeight(pRNode), nBlackHeight);
+        break;
+    }
+
+    case BALANCING_SPLAY:
+        /**
+         * The largest node splayed to the root node has no right child
+         */
+        pRootNode = SplayBinarySearchTree(pLeftBinaryTree->_pRootNode, INT_MAX);
+        pRootNode->SetRightNode(pRightBinaryTree->_pRootNode);
+
+        UpdateAugmentation(pRootNode);
+        break;
+
+    default:
+        pRootNode = JoinSubBinarySearchTrees(pLeftBinaryTree->_pRootNode, pRightBinaryTree->_pRootNode);
+        break;
+    }
+
+    AdoptBinaryTree(pRootNode, nNodeCount, iopBinaryTree);
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::Union(BinaryTree *&iopBinaryTree)
+{
+    if (!IsTreapOperand(iopBinaryTree))
+    {
+        return;
+    }
+
+    int nParallelDepth = RetrieveParallelDepth(_nNodeCount + iopBinaryTree->_nNodeCount);
+    int nRemovedCount(0);
+
+    Node *pRootNode = UnionTreaps(_pRootNode, iopBinaryTree->_pRootNode, nParallelDepth, nRemovedCount);
+
+    AdoptBinaryTree(pRootNode, _nNodeCount + iopBinaryTree->_nNodeCount - nRemovedCount, iopBinaryTree);
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::Intersection(BinaryTree *&iopBinaryTree)
+{
+    if (!IsTreapOperand(iopBinaryTree))
+    {
+        return;
+    }
+
+    int nParallelDepth = RetrieveParallelDepth(_nNodeCount + iopBinaryTree->_nNodeCount);
+    int nRemovedCount(0);
+
+    Node *pRootNode = IntersectTreaps(_pRootNode, iopBinaryTree->_pRootNode, nParallelDepth, nRemovedCount);
+
+    AdoptBinaryTree(pRootNode, _nNodeCount + iopBinaryTree->_nNodeCount - nRemovedCount, iopBinaryTree);
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::Difference(BinaryTree *&iopBinaryTree)
+{
+    if (!IsTreapOperand(iopBinaryTree))
+    {
+        return;
+    }
+
+    int nParallelDepth = RetrieveParallelDepth(_nNodeCount + iopBinaryTree->_nNodeCount);
+    int nRemovedCount(0);
+
+    Node *pRootNode = SubtractTreaps(_pRootNode, iopBinaryTree->_pRootNode, nParallelDepth, nRemovedCount);
+
+    AdoptBinaryTree(pRootNode, _nNodeCount + iopBinaryTree->_nNodeCount - nRemovedCount, iopBinaryTree);
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::EnableNodeIndex(int inExpectedCount)
+{
+    if (!_bCompleteTree)
+    {
+        std::cout << "ERR<<Node index needs a complete binary tree.>>" << std::endl;
+        return;
+    }
+
+    if (nullptr == _pNodeIndex)
+    {
+        _pNodeIndex = new NodeIndex(std::max<int>(inExpectedCount, _nNodeCount));
+    }
+    else
+    {
+        _pNodeIndex->Clear();
+        _pNodeIndex->Reserve(std::max<int>(inExpectedCount, _nNodeCount));
+    }
+
+    if (nullptr == _pRootNode)
+    {
+        return;
+    }
+
+    /**
+     * In level order the parent of the node at slot i is
+     * at slot (i - 1) / 2
+     */
+    std::vector<Node *> vNodes;
+
+    LevelOrderTraversalOfBinaryTreeNode(_pRootNode, vNodes);
+
+    for (int nSlot = 0; nSlot < (int)(vNodes.size()); ++nSlot)
+    {
+        _pNodeIndex->Insert(vNodes[nSlot]->GetData(),
+                            vNodes[nSlot],
+                            (0 < nSlot) ? vNodes[(nSlot - 1) / 2] : nullptr,
+                            nSlot);
+    }
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::DisableNodeIndex()
+{
+    delete _pNodeIndex;
+    _pNodeIndex = nullptr;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::EnableBloomFilter(int inExpectedCount,
+                                   double idFalsePositiveRate)
+{
+    delete _pBloomFilter;
+
+    _pBloomFilter = new BloomFilter(std::max<int>(inExpectedCount, _nNodeCount), idFalsePositiveRate);
+
+    RebuildBloomFilter();
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::RebuildBloomFilter()
+{
+    if (nullptr == _pBloomFilter)
+    {
+        return;
+    }
+
+    _pBloomFilter->Reset(std::max<int>(_pBloomFilter->Capacity(), _nNodeCount));
+
+    if (nullptr == _pRootNode)
+    {
+        return;
+    }
+
+    std::vector<Node *> vNodes;
+
+    LevelOrderTraversalOfBinaryTreeNode(_pRootNode, vNodes);
+
+    for (auto pNode : vNodes)
+    {
+        _pBloomFilter->Insert(pNode->GetData());
+    }
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::DisableBloomFilter()
+{
+    delete _pBloomFilter;
+    _pBloomFilter = nullptr;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::EnableRadixIndex()
+{
+    if (nullptr == _pRadixIndex)
+    {
+        _pRadixIndex = new AdaptiveRadixTree();
+    }
+    else
+    {
+        _pRadixIndex->Clear();
+    }
+
+    if (nullptr == _pRootNode)
+    {
+        return;
+    }
+
+    /**
+     * In level order the shallowest of the nodes holding the same
+     * data is indexed
+     */
+    std::vector<Node *> vNodes;
+
+    LevelOrderTraversalOfBinaryTreeNode(_pRootNode, vNodes);
+
+    for (auto pNode : vNodes)
+    {
+        _pRadixIndex->Insert(pNode->GetData(), pNode);
+    }
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::DisableRadixIndex()
+{
+    delete _pRadixIndex;
+    _pRadixIndex = nullptr;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::EnableOrderStatistics()
+{
+    if (!_bOrderedTree)
+    {
+        std::cout << "ERR<<Order statistics need a binary search tree.>>" << std::endl;
+        return;
+    }
+
+    if (!_bAugmentedNodes)
+    {
+        AugmentNodes();
+    }
+
+    std::vector<Node *> vNodes;
+
+    if (nullptr != _pRootNode)
+    {
+        LevelOrderTraversalOfBinaryTreeNode(_pRootNode, vNodes);
+    }
+
+    /**
+     * In reverse level order the children are sized before their parent
+     */
+    _bSubtreeSizes = true;
+
+    UpdateAugmentations(vNodes);
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::DisableOrderStatistics()
+{
+    _bSubtreeSizes = false;
+
+    if (!IsAugmented())
+    {
+        _bAugmentedNodes = false;
+    }
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::EnableSubtreeHeights()
+{
+    if (!_bOrderedTree)
+    {
+        std::cout << "ERR<<Subtree heights need a binary search tree.>>" << std::endl;
+        return;
+    }
+
+    if (!_bAugmentedNodes)
+    {
+        AugmentNodes();
+    }
+
+    std::vector<Node *> vNodes;
+
+    if (nullptr != _pRootNode)
+    {
+        LevelOrderTraversalOfBinaryTreeNode(_pRootNode, vNodes);
+    }
+
+    /**
+     * In reverse level order the children get their heights before
+     * their parent
+     */
+    _bSubtreeHeights = true;
+
+    UpdateAugmentations(vNodes);
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::DisableSubtreeHeights()
+{
+    _bSubtreeHeights = false;
+
+    if (!IsAugmented())
+    {
+        _bAugmentedNodes = false;
+    }
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::EnableRangeAggregates()
+{
+    if ((nullptr != _pRootNode) || (!_bOrderedTree))
+    {
+        std::cout << "ERR<<Range aggregates can only be enabled on an empty binary search tree.>>" << std::endl;
+        return;
+    }
+
+    _bRangeAggregates = true;
+    _bAugmentedNodes = true;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::DisableRangeAggregates()
+{
+    _bRangeAggregates = false;
+
+    if (!IsAugmented())
+    {
+        _bAugmentedNodes = false;
+    }
+}
+
+//-------------------------------------------------------------------
+bool BinaryTree::SetValue(int inData,
+                          int inValue)
+{
+    if (!_bRangeAggregates)
+    {
+        std::cout << "ERR<<Range aggregates are not enabled.>>" << std::endl;
+        return false;
+    }
+
+    std::vector<Node *> vPath;
+
+    Node *pNode = SearchInBinaryTree(_pRootNode, inData, vPath);
+
+    if (nullptr == pNode)
+    {
+        return false;
+    }
+
+    static_cast<AggregateNode *>(pNode)->SetValue(inValue);
+
+    UpdateAugmentation(pNode);
+    UpdateAugmentations(vPath);
+
+    return true;
+}
+
+//-------------------------------------------------------------------
+bool BinaryTree::RangeAggregate(int inLowData,
+                                int inHighData,
+                                long long &onSum,
+                                int &onMin,
+                                int &onMax)
+{
+    if (!_bRangeAggregates)
+    {
+        std::cout << "ERR<<Range aggregates are not enabled.>>" << std::endl;
+        return false;
+    }
+
+    /**
+     * Descend to the highest node within the interval, where the
+     * paths towards both of its ends part
+     */
+    Node *pSplitNode = _pRootNode;
+
+    while ((nullptr != pSplitNode) && ((pSplitNode->GetData() < inLowData) || (pSplitNode->GetData() > inHighData)))
+    {
+        pSplitNode = (pSplitNode->GetData() < inLowData) ? pSplitNode->GetRightNode() : pSplitNode->GetLeftNode();
+    }
+
+    if (nullptr == pSplitNode)
+    {
+        return false;
+    }
+
+    /**
+     * On the path towards the low end, every node within the interval
+     * brings its right sub-binary tree along; on the path towards the
+     * high end, its left one
+     */
+    AggregateNode::Summary objLowSummary = AggregateNode::Empty();
+    AggregateNode::Summary objHighSummary = AggregateNode::Empty();
+
+    for (Node *pNode = pSplitNode->GetLeftNode(); nullptr != pNode;)
+    {
+        if (pNode->GetData() >= inLowData)
+        {
+            objLowSummary = AggregateNode::Combine(AggregateNode::Combine(AggregateNode::SummaryOfValue(pNode),
+                                                                          AggregateNode::SummaryOf(pNode->GetRightNode())),
+                                                   objLowSummary);
+            pNode = pNode->GetLeftNode();
+        }
+        else
+        {
+            pNode = pNode->GetRightNode();
+        }
+    }
+
+    for (Node *pNode = pSplitNode->GetRightNode(); nullptr != pNode;)
+    {
+        if (pNode->GetData() <= inHighData)
+        {
+            objHighSummary = AggregateNode::Combine(objHighSummary,
+                                                    AggregateNode::Combine(AggregateNode::SummaryOf(pNode->GetLeftNode()),
+                                                                           AggregateNode::SummaryOfValue(pNode)));
+            pNode = pNode->GetRightNode();
+        }
+        else
+        {
+            pNode = pNode->GetLeftNode();
+        }
+    }
+
+    AggregateNode::Summary objSummary = AggregateNode::Combine(AggregateNode::Combine(objLowSummary,
+                                                                                      AggregateNode::SummaryOfValue(pSplitNode)),
+                                                               objHighSummary);
+
+    onSum = objSummary.nSum;
+    onMin = objSummary.nMin;
+    onMax = objSummary.nMax;
+
+    return true;
+}
+
+//-------------------------------------------------------------------
+bool BinaryTree::SearchInBinaryTree(int inData)
+{
+    if ((nullptr != _pDenseKeyBitmap) && (!std::atomic_ref<bool>(_bDenseKeysStale).load(std::memory_order_relaxed)))
+    {
+        return _pDenseKeyBitmap->Test(inData);
+    }
+
+    if (nullptr != _pRadixIndex)
+    {
+        return (nullptr != _pRadixIndex->Find(inData));
+    }
+
+    /**
+     * A complete binary tree may grow on other threads meanwhile, so
+     * its links are followed with acquire ordering
+     */
+    if (_bCompleteTree && (nullptr == _pNodeIndex))
+    {
+        if ((nullptr != _pBloomFilter) && (!_pBloomFilter->MayContain(inData)))
+        {
+            return false;
+        }
+
+        return (nullptr != SearchInCompleteBinaryTree(inData));
+    }
+
+    if ((BALANCING_SPLAY == _eBalancingMode) && (nullptr != _pRootNode))
+    {
+        if ((nullptr != _pBloomFilter) && (!_pBloomFilter->MayContain(inData)))
+        {
+            return false;
+        }
+
+        _pRootNode = SplayBinarySearchTree(_pRootNode, inData);
+
+        return (inData == _pRootNode->GetData());
+    }
+
+    bool bFound(false);
+
+    Node *pParentNode = nullptr;
+    int nDepth(0);
+
+    if (nullptr != LocateNode(inData, pParentNode, nDepth))
+    {
+        bFound = true;
+    }
+
+    return bFound;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::SearchInBinaryTree(const std::vector<int> &ivData,
+                                    std::vector<bool> &ovFound)
+{
+    const int nSize = (int)(ivData.size());
+
+    ovFound.assign(nSize, false);
+
+    /**
+     * Data answered by the dense key bitmap or an index, or
+     * rejected by the Bloom filter need no walk of the binary tree
+     */
+    std::vector<int> vPending;
+
+    vPending.reserve(nSize);
+
+    const bool bDenseKeys = (nullptr != _pDenseKeyBitmap) && (!_bDenseKeysStale);
+
+    for (int nIdx = 0; nIdx < nSize; ++nIdx)
+    {
+        if (bDenseKeys)
+        {
+            ovFound[nIdx] = _pDenseKeyBitmap->Test(ivData[nIdx]);
+            continue;
+        }
+
+        if ((nullptr != _pBloomFilter) && (!_pBloomFilter->MayContain(ivData[nIdx])))
+        {
+            continue;
+        }
+
+        if (nullptr != _pRadixIndex)
+        {
+            ovFound[nIdx] = (nullptr != _pRadixIndex->Find(ivData[nIdx]));
+            continue;
+        }
+
+        if (nullptr != _pNodeIndex)
+        {
+            ovFound[nIdx] = (nullptr != _pNodeIndex->Find(ivData[nIdx]));
+            continue;
+        }
+
+        vPending.push_back(nIdx);
+    }
+
+    if ((vPending.empty()) || (nullptr == _pRootNode))
+    {
+        return;
+    }
+
+    if (!_bOrderedTree)
+    {
+        std::unordered_set<int> setPending;
+
+        setPending.reserve(vPending.size());
+
+        for (auto nIdx : vPending)
+        {
+            setPending.insert(ivData[nIdx]);
+        }
+
+        std::unordered_set<int> setFound;
+
+        std::vector<Node *> vStack(1, _pRootNode);
+
+        while ((!vStack.empty()) && (setFound.size() < setPending.size()))
+        {
+            Node *pNode = vStack.back();
+
+            vStack.pop_back();
+
+            if (setPending.count(pNode->GetData()))
+            {
+                setFound.insert(pNode->GetData());
+            }
+
+            if (nullptr != pNode->GetRightNode())
+            {
+                vStack.push_back(pNode->GetRightNode());
+            }
+
+            if (nullptr != pNode->GetLeftNode())
+            {
+                vStack.push_back(pNode->GetLeftNode());
+            }
+        }
+
+        for (auto nIdx : vPending)
+        {
+            ovFound[nIdx] = (0 < setFound.count(ivData[nIdx]));
+        }
+
+        return;
+    }
+
+    /**
+     * Each lane runs one descent. A lane moves one level per round
+     * and prefetches its next node, which is only dereferenced in
+     * the next round, after all other lanes have issued theirs.
+     * A finished lane takes over the next pending data.
+     */
+    const int nLanes = 16;
+
+    int anLaneData[nLanes];
+    Node *apLaneNode[nLanes];
+
+    int nActiveLanes(0);
+    int nNextPending(0);
+
+    for (; (nActiveLanes < nLanes) && (nNextPending < (int)(vPending.size())); ++nActiveLanes)
+    {
+        anLaneData[nActiveLanes] = vPending[nNextPending++];
+        apLaneNode[nActiveLanes] = _pRootNode;
+    }
+
+    while (0 < nActiveLanes)
+    {
+        for (int nLane = 0; nLane < nActiveLanes;)
+        {
+            Node *pNode = apLaneNode[nLane];
+            int nData = ivData[anLaneData[nLane]];
+
+            if ((nullptr != pNode) && (pNode->GetData() != nData))
+            {
+                pNode = pNode->GetChildNode(nData >= pNode->GetData());
+
+                __builtin_prefetch(pNode);
+
+                apLaneNode[nLane++] = pNode;
+                continue;
+            }
+
+            ovFound[anLaneData[nLane]] = (nullptr != pNode);
+
+            if (nNextPending < (int)(vPending.size()))
+            {
+                anLaneData[nLane] = vPending[nNextPending++];
+                apLaneNode[nLane] = _pRootNode;
+            }
+            else
+            {
+                --nActiveLanes;
+
+                anLaneData[nLane] = anLaneData[nActiveLanes];
+                apLaneNode[nLane] = apLaneNode[nActiveLanes];
+            }
+        }
+    }
+}
+
+//-------------------------------------------------------------------
+int BinaryTree::CountDistinctDataLessThan(int inData)
+{
+    if ((nullptr != _pDenseKeyBitmap) && (!_bDenseKeysStale))
+    {
+        return _pDenseKeyBitmap->Rank(inData);
+    }
+
+    std::unordered_set<int> setData;
+
+    std::vector<Node *> vStack;
+
+    if (nullptr != _pRootNode)
+    {
+        vStack.push_back(_pRootNode);
+    }
+
+    while (!vStack.empty())
+    {
+        Node *pNode = vStack.back();
+
+        vStack.pop_back();
+
+        if (pNode->GetData() < inData)
+        {
+            setData.insert(pNode->GetData());
+        }
+
+        /**
+         * Right of a node not less than the data, a binary search
+         * tree holds no smaller data
+         */
+        if ((nullptr != pNode->GetRightNode()) && ((!_bOrderedTree) || (pNode->GetData() < inData)))
+        {
+            vStack.push_back(pNode->GetRightNode());
+        }
+
+        if (nullptr != pNode->GetLeftNode())
+        {
+            vStack.push_back(pNode->GetLeftNode());
+        }
+    }
+
+    return (int)(setData.size());
+}
+
+//-------------------------------------------------------------------
+int BinaryTree::Rank(int inData)
+{
+    if (!_bSubtreeSizes)
+    {
+        std::cout << "ERR<<Order statistics are not enabled.>>" << std::endl;
+        return -1;
+    }
+
+    return RankOfData(inData, false);
+}
+
+//-------------------------------------------------------------------
+bool BinaryTree::Select(int inRank,
+                        int &onData)
+{
+    if (!_bSubtreeSizes)
+    {
+        std::cout << "ERR<<Order statistics are not enabled.>>" << std::endl;
+        return false;
+    }
+
+    if ((0 > inRank) || (RetrieveSubtreeSize(_pRootNode) <= inRank))
+    {
+        return false;
+    }
+
+    Node *pNode = _pRootNode;
+
+    while (nullptr != pNode)
+    {
+        const int nLSize = RetrieveSubtreeSize(pNode->GetLeftNode());
+
+        if (inRank < nLSize)
+        {
+            pNode = pNode->GetLeftNode();
+        }
+        else if (inRank < (nLSize + pNode->GetCount()))
+        {
+            onData = pNode->GetData();
+            return true;
+        }
+        else
+        {
+            inRank -= nLSize + pNode->GetCount();
+            pNode = pNode->GetRightNode();
+        }
+    }
+
+    return false;
+}
+
+//-------------------------------------------------------------------
+bool BinaryTree::KthSmallest(int inK,
+                             int &onData)
+{
+    return Select(inK - 1, onData);
+}
+
+//-------------------------------------------------------------------
+bool BinaryTree::KthLargest(int inK,
+                            int &onData)
+{
+    return Select(RetrieveSubtreeSize(_pRootNode) - inK, onData);
+}
+
+//-------------------------------------------------------------------
+int BinaryTree::CountOfData()
+{
+    if (_bSubtreeSizes)
+    {
+        return RetrieveSubtreeSize(_pRootNode);
+    }
+
+    if (!_bMultiset)
+    {
+        return _nNodeCount;
+    }
+
+    std::vector<Node *> vNodes;
+
+    if (nullptr != _pRootNode)
+    {
+        LevelOrderTraversalOfBinaryTreeNode(_pRootNode, vNodes);
+    }
+
+    int nCount(0);
+
+    for (auto pNode : vNodes)
+    {
+        nCount += pNode->GetCount();
+    }
+
+    return nCount;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::RangeQuery(int inLowData,
+                            int inHighData,
+                            std::vector<int> &iovData,
+                            bool ibExpandDuplicates)
+{
+    std::vector<Node *> vNodes;
+
+    RetrieveRangeNodes(inLowData, inHighData, vNodes);
+
+    for (auto pNode : vNodes)
+    {
+        iovData.insert(iovData.end(), ibExpandDuplicates ? pNode->GetCount() : 1, pNode->GetData());
+    }
+}
+
+//-------------------------------------------------------------------
+int BinaryTree::RangeCount(int inLowData,
+                           int inHighData)
+{
+    if (inLowData > inHighData)
+    {
+        return 0;
+    }
+
+    if (_bSubtreeSizes)
+    {
+        return RankOfData(inHighData, true) - RankOfData(inLowData, false);
+    }
+
+    std::vector<Node *> vNodes;
+
+    RetrieveRangeNodes(inLowData, inHighData, vNodes);
+
+    int nCount(0);
+
+    for (auto pNode : vNodes)
+    {
+        nCount += pNode->GetCount();
+    }
+
+    return nCount;
+}
+
+//-------------------------------------------------------------------
+bool BinaryTree::Floor(int inData,
+                       int &onData)
+{
+    return RetrieveNeighbourData(inData, false, true, onData);
+}
+
+//-------------------------------------------------------------------
+bool BinaryTree::Ceiling(int inData,
+                         int &onData)
+{
+    return RetrieveNeighbourData(inData, true, true, onData);
+}
+
+//-------------------------------------------------------------------
+bool BinaryTree::Predecessor(int inData,
+                             int &onData)
+{
+    return RetrieveNeighbourData(inData, false, false, onData);
+}
+
+//-------------------------------------------------------------------
+bool BinaryTree::Successor(int inData,
+                           int &onData)
+{
+    return RetrieveNeighbourData(inData, true, false, onData);
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::PreOrderTraversal()
+{
+    if (IsEmpty())
+    {
+        return;
+    }
+
+    std::vector<Node *> vNodes;
+
+    PreOrderTraversalOfBinaryTreeNode(_pRootNode, vNodes);
+
+    std::cout << "Pre order traversal: ";
+
+    for (auto pNode : vNodes)
+    {
+        if (nullptr != pNode)
+        {
+            std::cout << pNode->GetData() << " ";
+        }
+    }
+
+    std::cout << std::endl;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::InOrderTraversal(bool ibExpandDuplicates)
+{
+    if (IsEmpty())
+    {
+        return;
+    }
+
+    std::vector<Node *> vNodes;
+
+    InOrderTraversalOfBinaryTreeNode(_pRootNode, vNodes);
+
+    std::cout << "In order traversal: ";
+
+    for (auto pNode : vNodes)
+    {
+        if (nullptr == pNode)
+        {
+            continue;
+        }
+
+        if (ibExpandDuplicates)
+        {
+            for (int nCount = 0; nCount < pNode->GetCount(); ++nCount)
+            {
+                std::cout << pNode->GetData() << " ";
+            }
+        }
+        else if (1 < pNode->GetCount())
+        {
+            std::cout << pNode->GetData() << "x" << pNode->GetCount() << " ";
+        }
+        else
+        {
+            std::cout << pNode->GetData() << " ";
+        }
+    }
+
+    std::cout << std::endl;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::RetrieveInOrderData(std::vector<int> &iovData,
+                                     bool ibExpandDuplicates)
+{
+    std::vector<Node *> vNodes;
+
+    InOrderTraversalOfBinaryTreeNode(_pRootNode, vNodes);
+
+    for (auto pNode : vNodes)
+    {
+        iovData.insert(iovData.end(), ibExpandDuplicates ? pNode->GetCount() : 1, pNode->GetData());
+    }
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::PostOrderTraversal()
+{
+    if (IsEmpty())
+    {
+        return;
+    }
+
+    std::vector<Node *> vNodes;
+
+    PostOrderTraversalOfBinaryTreeNode(_pRootNode, vNodes);
+
+    std::cout << "Post order traversal: ";
+
+    for (auto pNode : vNodes)
+    {
+        if (nullptr != pNode)
+        {
+            std::cout << pNode->GetData() << " ";
+        }
+    }
+
+    std::cout << std::endl;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::LevelOrderTraversal()
+{
+    if (IsEmpty())
+    {
+        return;
+    }
+
+    std::vector<Node *> vNodes;
+
+    LevelOrderTraversalOfBinaryTreeNode(_pRootNode, vNodes);
+
+    std::cout << "Level order traversal: ";
+
+    for (auto pNode : vNodes)
+    {
+        if (nullptr != pNode)
+        {
+            std::cout << pNode->GetData() << " ";
+        }
+    }
+
+    std::cout << std::endl;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::ReverseLevelOrderTraversal()
+{
+    if (IsEmpty())
+    {
+        return;
+    }
+
+    std::deque<Node *> dqNodes;
+
+    ReverseLevelOrderTraversalOfBinaryTreeNode(_pRootNode, dqNodes);
+
+    std::cout << "Reverse-level order traversal: ";
+
+    Node *pNode = nullptr;
+
+    while (!dqNodes.empty())
+    {
+        pNode = dqNodes.front();
+
+        dqNodes.pop_front();
+
+        if (nullptr != pNode)
+        {
+            std::cout << pNode->GetData() << " ";
+        }
+    }
+
+    std::cout << std::endl;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::SpiralOrderTraversal()
+{
+    if (IsEmpty())
+    {
+        return;
+    }
+
+    std::vector<Node *> vNodes;
+
+    SpiralOrderTraversalOfBinaryTreeNode(_pRootNode, vNodes);
+
+    std::cout << "Spiral-level order traversal: ";
+
+    for (auto pNode : vNodes)
+    {
+        if (nullptr != pNode)
+        {
+            std::cout << pNode->GetData() << " ";
+        }
+    }
+
+    std::cout << std::endl;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::PrintLeafNodes()
+{
+    if (IsEmpty())
+    {
+        return;
+    }
+
+    std::vector<Node *> vNodes;
+
+    RetrieveLeafNodesOfBinaryTreeNode(_pRootNode, vNodes);
+
+    std::cout << "Leaf nodes: ";
+
+    for (auto pNode : vNodes)
+    {
+        if (nullptr != pNode)
+        {
+            std::cout << pNode->GetData() << " ";
+        }
+    }
+
+    std::cout << std::endl;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::PrintNonLeafNodes()
+{
+    if (IsEmpty())
+    {
+        return;
+    }
+
+    std::vector<Node *> vNodes;
+
+    RetrieveNonLeafNodesOfBinaryTreeNode(_pRootNode, vNodes);
+
+    std::cout << "Non-leaf nodes: ";
+
+    for (auto pNode : vNodes)
+    {
+        if (nullptr != pNode)
+        {
+            std::cout << pNode->GetData() << " ";
+        }
+    }
+
+    std::cout << std::endl;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::PrintBoundaryNodes()
+{
+    if (IsEmpty())
+    {
+        return;
+    }
+
+    std::vector<Node *> vNodes;
+
+    vNodes.push_back(_pRootNode);
+
+    RetrieveLeftBoundaryNodesOfBinaryTreeNode(_pRootNode->GetLeftNode(),
+                                              vNodes);
+
+    RetrieveLeafNodesOfBinaryTreeNode(_pRootNode,
+                                      vNodes);
+
+    RetrieveRightBoundaryNodesOfBinaryTreeNode(_pRootNode->GetRightNode(),
+                                               vNodes);
+
+    std::cout << "Boundary nodes: ";
+
+    for (auto pNode : vNodes)
+    {
+        if (nullptr != pNode)
+        {
+            std::cout << pNode->GetData() << " ";
+        }
+    }
+
+    std::cout << std::endl;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::PrintAllFullNodes()
+{
+    std::vector<Node *> vNodes;
+
+    PrintFullNodes(_pRootNode,
+                   vNodes);
+
+    std::cout << "Full nodes: ";
+
+    for (auto pNode : vNodes)
+    {
+        if (nullptr != pNode)
+        {
+            std::cout << pNode->GetData() << " ";
+        }
+    }
+
+    std::cout << std::endl;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::PrintAllHalfNodes()
+{
+    std::vector<Node *> vNodes;
+
+    PrintHalfNodes(_pRootNode,
+                   vNodes);
+
+    std::cout << "Half nodes: ";
+
+    for (auto pNode : vNodes)
+    {
+        if (nullptr != pNode)
+        {
+            std::cout << pNode->GetData() << " ";
+        }
+    }
+
+    std::cout << std::endl;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::PrintAllNodesAtKDistance(int inKDistance)
+{
+    std::vector<Node *> vNodes;
+
+    RetrieveAllNodesAtKDistance(_pRootNode,
+                                inKDistance,
+                                vNodes);
+
+    std::cout << "All nodes at 'k' distance: ";
+
+    for (auto pNode : vNodes)
+    {
+        if (nullptr != pNode)
+        {
+            std::cout << pNode->GetData() << " ";
+        }
+    }
+
+    std::cout << std::endl;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::PrintSibling(int inData)
+{
+    Node *pParentNode = nullptr;
+    int nDepth(0);
+
+    Node *pNode = LocateNode(inData, pParentNode, nDepth);
+
+    if ((nullptr != pNode) && (nullptr != pParentNode))
+    {
+        pNode = (pParentNode->GetLeftNode() == pNode) ? pParentNode->GetRightNode()
+                                                      : pParentNode->GetLeftNode();
+    }
+    else
+    {
+        pNode = nullptr;
+    }
+
+    if (nullptr != pNode)
+    {
+        std::cout << "Sibling of " << inData << ": " << pNode->GetData();
+    }
+    else
+    {
+        std::cout << "No sibling present for the given data." << std::endl;
+    }
+
+    std::cout << std::endl;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::PrintCousins(int inData)
+{
+    std::vector<Node *> vNodes;
+
+    Node *pParentNode = nullptr;
+    int nDepth(0);
+
+    /**
+     * Cousins are all nodes at the same depth
+     * except the node and its sibling
+     */
+    if ((nullptr != LocateNode(inData, pParentNode, nDepth)) && (nullptr != pParentNode))
+    {
+        std::vector<Node *> vLevelNodes;
+
+        RetrieveAllNodesAtKDistance(_pRootNode,
+                                    nDepth,
+                                    vLevelNodes);
+
+        for (auto pNode : vLevelNodes)
+        {
+            if ((pParentNode->GetLeftNode() != pNode) && (pParentNode->GetRightNode() != pNode))
+            {
+                vNodes.push_back(pNode);
+            }
+        }
+    }
+
+    std::cout << "Cousins of " << inData << ": ";
+
+    for (auto pNode : vNodes)
+    {
+        if (nullptr != pNode)
+        {
+            std::cout << pNode->GetData() << " ";
+        }
+    }
+
+    std::cout << std::endl;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::PrintAncestors(int inData)
+{
+    if (IsEmpty())
+    {
+        return;
+    }
+
+    std::vector<Node *> vPath;
+
+    Node *pNode = SearchInBinaryTree(_pRootNode,
+                                     inData,
+                                     vPath);
+
+    if (nullptr != pNode)
+    {
+        std::cout << "Ancestors of " << inData << ": ";
+
+        for (auto pNode : vPath)
+        {
+            if (nullptr != pNode)
+            {
+                std::cout << pNode->GetData() << " ";
+            }
+        }
+    }
+    else
+    {
+        std::cout << "Node is not found for the given data." << std::endl;
+    }
+
+    std::cout << std::endl;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::PrintDecendants(int inData)
+{
+    Node *pParentNode = nullptr;
+    int nDepth(0);
+
+    Node *pNode = LocateNode(inData, pParentNode, nDepth);
+
+    std::vector<Node *> vNodes;
+
+    PreOrderTraversalOfBinaryTreeNode(pNode,
+                                      vNodes);
+
+    std::cout << "Decendants of " << inData << ": ";
+
+    for (auto pNode : vNodes)
+    {
+        if (nullptr != pNode)
+        {
+            std::cout << pNode->GetData() << " ";
+        }
+    }
+
+    std::cout << std::endl;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::PrintAncestor(int inData)
+{
+    Node *pParentNode = nullptr;
+    int nDepth(0);
+
+    if (nullptr != LocateNode(inData, pParentNode, nDepth))
+    {
+        if (nullptr != pParentNode)
+        {
+            std::cout << "Ancestor of " << inData << ": " << pParentNode->GetData();
+        }
+        else
+        {
+            std::cout << "Root node has no ancestor.";
+        }
+    }
+    else
+    {
+        std::cout << "Node is not found for the given data." << std::endl;
+    }
+
+    std::cout << std::endl;
+}
+
+//-------------------------------------------------------------------
+int BinaryTree::HeightOfBinaryTree()
+{
+    /**
+     * A complete binary tree fills every level but the last one
+     */
+    if (_bCompleteTree)
+    {
+        return (int)(std::bit_width((unsigned int)(_nNodeCount))) - 1;
+    }
+
+    return HeightOfSubBinaryTree(_pRootNode);
+}
+
+//-------------------------------------------------------------------
+int BinaryTree::HeightOfNode(int inData)
+{
+    /**
+     * A complete binary tree fills its last level from the left, so a
+     * node reaches that level if the leftmost position below it there
+     * is taken
+     */
+    if ((nullptr != _pNodeIndex) && (!_bSubtreeHeights))
+    {
+        NodeIndex::Entry *pEntry = _pNodeIndex->Find(inData);
+
+        if (nullptr == pEntry)
+        {
+            return -1;
+        }
+
+        const int nHeight = HeightOfBinaryTree() - pEntry->nDepth;
+        const long long nLeftmostPosition = ((long long)(pEntry->nPosition + 1) << nHeight) - 1;
+
+        return (nLeftmostPosition < _nNodeCount) ? nHeight : (nHeight - 1);
+    }
+
+    Node *pParentNode = nullptr;
+    int nDepth(0);
+
+    Node *pNode = LocateNode(inData, pParentNode, nDepth);
+
+    if (nullptr == pNode)
+    {
+        return -1;
+    }
+
+    if (_bCompleteTree && (!_bSubtreeHeights))
+    {
+        /**
+         * The leftmost path of a node is one of its longest paths
+         */
+        int nHeight(0);
+
+        for (Node *pLNode = pNode->GetLeftNode(); nullptr != pLNode; pLNode = pLNode->GetLeftNode())
+        {
+            ++nHeight;
+        }
+
+        return nHeight;
+    }
+
+    return HeightOfSubBinaryTree(pNode);
+}
+
+//-------------------------------------------------------------------
+int BinaryTree::FindLevelOfNode(int inData)
+{
+    int nLevel(-1);
+
+    Node *pParentNode = nullptr;
+    int nDepth(0);
+
+    if (nullptr != LocateNode(inData, pParentNode, nDepth))
+    {
+        nLevel = nDepth;
+    }
+
+    return nLevel;
+}
+
+//===================================================================
+// Private Methods: Implementation
+//===================================================================
+
+//-------------------------------------------------------------------
+BinaryTree::BinaryTree() : _pRootNode(nullptr),
+                           _nNodeCount(0),
+                           _bCompleteTree(true),
+                           _bOrderedTree(true),
+                           _bMultiset(false),
+                           _pNodeIndex(nullptr),
+                           _pBloomFilter(nullptr),
+                           _bBranchlessSearch(false),
+                           _pDenseKeyBitmap(nullptr),
+                           _nMinData(0),
+                           _nMaxData(0),
+                           _bDenseKeysStale(false),
+                           _pRadixIndex(nullptr),
+                           _eBalancingMode(BALANCING_NONE),
+                           _nMaxNodeCount(0),
+                           _bSubtreeSizes(false),
+                           _bRangeAggregates(false),
+                           _bSubtreeHeights(false),
+                           _bAugmentedNodes(false)
+{
+}
+
+//-------------------------------------------------------------------
+BinaryTree::~BinaryTree()
+{
+    delete _pNodeIndex;
+    _pNodeIndex = nullptr;
+
+    delete _pBloomFilter;
+    _pBloomFilter = nullptr;
+
+    delete _pDenseKeyBitmap;
+    _pDenseKeyBitmap = nullptr;
+
+    delete _pRadixIndex;
+    _pRadixIndex = nullptr;
+}
+
+//-------------------------------------------------------------------
+BinaryTree *BinaryTree::CreateBinaryTreeFromTraversals(const std::vector<int> &ivOrder,
+                                                       const std::vector<int> &ivInOrder,
+                                                       bool ibPostOrder)
+{
+    const int nSize = (int)(ivOrder.size());
+
+    if ((0 == nSize) || (ivInOrder.size() != ivOrder.size()))
+    {
+        std::cout << "ERR<<Traversal sequences are empty or of different length.>>" << std::endl;
+        return nullptr;
+    }
+
+    std::unordered_map<int, int> mpInOrderPosition;
+
+    mpInOrderPosition.reserve(nSize);
+
+    for (int nIdx = 0; nIdx < nSize; ++nIdx)
+    {
+        if (!mpInOrderPosition.emplace(ivInOrder[nIdx], nIdx).second)
+        {
+            std::cout << "ERR<<Traversal sequences hold duplicate data.>>" << std::endl;
+            return nullptr;
+        }
+    }
+
+    BinaryTree *pBinaryTree = CreateBinaryTree();
+
+    /**
+     * Post-order read backwards is root, right, left. It is
+     * the pre-order of the mirrored tree, so the same walk
+     * applies with the children and the positions swapped.
+     */
+    auto fnDataAt = [&](int inIdx)
+    {
+        return ivOrder[ibPostOrder ? (nSize - 1 - inIdx) : inIdx];
+    };
+
+    auto fnPositionOf = [&](int inData)
+    {
+        auto itPosition = mpInOrderPosition.find(inData);
+
+        if (mpInOrderPosition.end() == itPosition)
+        {
+            return -1;
+        }
+
+        return ibPostOrder ? (nSize - 1 - itPosition->second) : itPosition->second;
+    };
+
+    auto fnFirstChild = [ibPostOrder](Node *ipNode)
+    {
+        return ibPostOrder ? ipNode->GetRightNode() : ipNode->GetLeftNode();
+    };
+
+    auto fnSecondChild = [ibPostOrder](Node *ipNode)
+    {
+        return ibPostOrder ? ipNode->GetLeftNode() : ipNode->GetRightNode();
+    };
+
+    auto fnSetFirstChild = [ibPostOrder](Node *ipNode, Node *ipChildNode)
+    {
+        if (ibPostOrder)
+        {
+            ipNode->SetRightNode(ipChildNode);
+        }
+        else
+        {
+            ipNode->SetLeftNode(ipChildNode);
+        }
+    };
+
+    auto fnSetSecondChild = [ibPostOrder](Node *ipNode, Node *ipChildNode)
+    {
+        if (ibPostOrder)
+        {
+            ipNode->SetLeftNode(ipChildNode);
+        }
+        else
+        {
+            ipNode->SetRightNode(ipChildNode);
+        }
+    };
+
+    /**
+     * The stack holds the path of nodes which may still receive
+     * their second child, along with their in-order position.
+     */
+    std::vector<std::pair<Node *, int>> vPath;
+
+    bool bValid(true);
+
+    for (int nIdx = 0; nIdx < nSize; ++nIdx)
+    {
+        int nData = fnDataAt(nIdx);
+        int nPosition = fnPositionOf(nData);
+
+        if (0 > nPosition)
+        {
+            bValid = false;
+            break;
+        }
+
+        Node *pNewNode = new Node(nData);
+        Node *pParentNode = nullptr;
+
+        if (0 == nIdx)
+        {
+            pBinaryTree->_pRootNode = pNewNode;
+        }
+        else if (nPosition < vPath.back().second)
+        {
+            pParentNode = vPath.back().first;
+
+            if (nullptr == fnFirstChild(pParentNode))
+            {
+                fnSetFirstChild(pParentNode, pNewNode);
+            }
+            else
+            {
+                bValid = false;
+            }
+        }
+        else
+        {
+            while ((!vPath.empty()) && (vPath.back().second < nPosition))
+            {
+                pParentNode = vPath.back().first;
+                vPath.pop_back();
+            }
+
+            if ((nullptr != pParentNode) && (nullptr == fnSecondChild(pParentNode)))
+            {
+                fnSetSecondChild(pParentNode, pNewNode);
+            }
+            else
+            {
+                bValid = false;
+            }
+        }
+
+        if (!bValid)
+        {
+            delete pNewNode;
+            break;
+        }
+
+        vPath.emplace_back(pNewNode, nPosition);
+
+        ++pBinaryTree->_nNodeCount;
+    }
+
+    /**
+     * Both sequences must describe the same tree, which holds
+     * if the in-order walk of the rebuilt tree matches.
+     */
+    if (bValid)
+    {
+        std::vector<Node *> vStack;
+
+        Node *pNode = pBinaryTree->_pRootNode;
+
+        int nIdx(0);
+
+        while (bValid && ((nullptr != pNode) || (!vStack.empty())))
+        {
+            while (nullptr != pNode)
+            {
+                vStack.push_back(pNode);
+                pNode = pNode->GetLeftNode();
+            }
+
+            pNode = vStack.back();
+            vStack.pop_back();
+
+            bValid = (nIdx < nSize) && (ivInOrder[nIdx++] == pNode->GetData());
+
+            pNode = pNode->GetRightNode();
+        }
+
+        bValid = bValid && (nSize == nIdx);
+    }
+
+    for (int nIdx = 1; bValid && (nIdx < nSize); ++nIdx)
+    {
+        if (ivInOrder[nIdx] < ivInOrder[nIdx - 1])
+        {
+            pBinaryTree->_bOrderedTree = false;
+            break;
+        }
+    }
+
+    if (!bValid)
+    {
+        std::cout << "ERR<<Traversal sequences do not describe the same binary tree.>>" << std::endl;
+
+        RemoveBinaryTree(pBinaryTree);
+        return nullptr;
+    }
+
+    pBinaryTree->_bCompleteTree = false;
+
+    pBinaryTree->RebuildDenseKeyBitmap();
+
+    return pBinaryTree;
+}
+
+//-------------------------------------------------------------------
+Node *BinaryTree::BuildBalancedSubBinaryTree(std::istream &ioStream,
+                                             int inCount,
+                                             long long &ionPreviousData,
+                                             bool &iobValid)
+{
+    if ((0 >= inCount) || (!iobValid))
+    {
+        return nullptr;
+    }
+
+    /**
+     * Build the left half first, then the node from the next
+     * data of the stream, then the right half from the rest.
+     */
+    int nLeftCount = (inCount - 1) / 2;
+
+    Node *pLNode = BuildBalancedSubBinaryTree(ioStream,
+                                              nLeftCount,
+                                              ionPreviousData,
+                                              iobValid);
+
+    int nData(0);
+
+    if ((!iobValid) || (!(ioStream >> nData)) || (nData < ionPreviousData))
+    {
+        iobValid = false;
+
+        if (nullptr != pLNode)
+        {
+            RemoveChildren(pLNode);
+            delete pLNode;
+        }
+
+        return nullptr;
+    }
+
+    ionPreviousData = nData;
+
+    Node *pNode = new Node(nData);
+
+    pNode->SetLeftNode(pLNode);
+    pNode->SetRightNode(BuildBalancedSubBinaryTree(ioStream,
+                                                   inCount - 1 - nLeftCount,
+                                                   ionPreviousData,
+                                                   iobValid));
+
+    if (!iobValid)
+    {
+        RemoveChildren(pNode);
+        delete pNode;
+
+        pNode = nullptr;
+    }
+
+    return pNode;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::RemoveChildren(Node *ipParentNode,
+                                int inParallelDepth)
+{
+    if (nullptr == ipParentNode)
+    {
+        return;
+    }
+
+    Node *pLNode = ipParentNode->GetLeftNode();
+    Node *pRNode = ipParentNode->GetRightNode();
+
+    ipParentNode->SetLeftNode(nullptr);
+    ipParentNode->SetRightNode(nullptr);
+
+    if (0 < inParallelDepth)
+    {
+        std::thread objThread1(&BinaryTree::RemoveChildren, this, pLNode, inParallelDepth - 1);
+
+        RemoveChildren(pRNode, inParallelDepth - 1);
+
+        objThread1.join();
+
+        delete pLNode;
+        delete pRNode;
+
+        return;
+    }
+
+    std::vector<Node *> vNodes;
+
+    for (Node *pNode : {pLNode, pRNode})
+    {
+        if (nullptr != pNode)
+        {
+            vNodes.push_back(pNode);
+        }
+    }
+
+    while (!vNodes.empty())
+    {
+        Node *pNode = vNodes.back();
+
+        vNodes.pop_back();
+
+        if (nullptr != pNode->GetLeftNode())
+        {
+            vNodes.push_back(pNode->GetLeftNode());
+        }
+
+        if (nullptr != pNode->GetRightNode())
+        {
+            vNodes.push_back(pNode->GetRightNode());
+        }
+
+        delete pNode;
+    }
+}
+
+//-------------------------------------------------------------------
+Node *BinaryTree::LinkNodeAtSlot(Node *ipNewNode,
+                                 int inSlot)
+{
+    if (0 == inSlot)
+    {
+        std::atomic_ref<Node *>(_pRootNode).store(ipNewNode, std::memory_order_release);
+        return nullptr;
+    }
+
+    Node *pParentNode = RetrieveNodeAtSlot((inSlot - 1) / 2);
+
+    if (inSlot & 1)
+    {
+        pParentNode->PublishLeftNode(ipNewNode);
+    }
+    else
+    {
+        pParentNode->PublishRightNode(ipNewNode);
+    }
+
+    return pParentNode;
+}
+
+//-------------------------------------------------------------------
+Node *BinaryTree::RetrieveNodeAtSlot(int inSlot)
+{
+    std::atomic_ref<Node *> pRootNode(_pRootNode);
+
+    Node *pNode = nullptr;
+
+    while (nullptr == (pNode = pRootNode.load(std::memory_order_acquire)))
+    {
+        std::this_thread::yield();
+    }
+
+    unsigned int nPosition = inSlot + 1;
+
+    Node *pNextNode = nullptr;
+
+    for (int nBit = std::bit_width(nPosition) - 2; 0 <= nBit; --nBit)
+    {
+        if ((nPosition >> nBit) & 1)
+        {
+            while (nullptr == (pNextNode = pNode->AcquireRightNode()))
+            {
+                std::this_thread::yield();
+            }
+        }
+        else
+        {
+            while (nullptr == (pNextNode = pNode->AcquireLeftNode()))
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        pNode = pNextNode;
+    }
+
+    return pNode;
+}
+
+//-------------------------------------------------------------------
+Node *BinaryTree::SearchInCompleteBinaryTree(int inData)
+{
+    std::vector<Node *> vNodes;
+
+    Node *pNode = std::atomic_ref<Node *>(_pRootNode).load(std::memory_order_acquire);
+
+    if (nullptr != pNode)
+    {
+        vNodes.push_back(pNode);
+    }
+
+    while (!vNodes.empty())
+    {
+        pNode = vNodes.back();
+        vNodes.pop_back();
+
+        if (pNode->GetData() == inData)
+        {
+            return pNode;
+        }
+
+        /**
+         * A slot claimed but not linked yet reads as null
+         */
+        for (Node *pChildNode : {pNode->AcquireRightNode(), pNode->AcquireLeftNode()})
+        {
+            if (nullptr != pChildNode)
+            {
+                vNodes.push_back(pChildNode);
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::ReplaceChild(Node *ipParentNode,
+                              Node *ipOldNode,
+                              Node *ipNewNode)
+{
+    if (nullptr == ipParentNode)
+    {
+        _pRootNode = ipNewNode;
+    }
+    else if (ipParentNode->GetLeftNode() == ipOldNode)
+    {
+        ipParentNode->SetLeftNode(ipNewNode);
+    }
+    else
+    {
+        ipParentNode->SetRightNode(ipNewNode);
+    }
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::RemoveNodeFromBinarySearchTree(Node *ipNode,
+                                                Node *ipParentNode)
+{
+    Node *pLNode = ipNode->GetLeftNode();
+    Node *pRNode = ipNode->GetRightNode();
+
+    if ((nullptr == pLNode) || (nullptr == pRNode))
+    {
+        ReplaceChild(ipParentNode, ipNode, (nullptr != pLNode) ? pLNode : pRNode);
+        return;
+    }
+
+    /**
+     * The in-order successor, i.e. the leftmost node of the right
+     * sub-binary tree, takes the place of the node. Its own right
+     * child takes the place of the successor.
+     */
+    Node *pSuccessorParentNode = ipNode;
+    Node *pSuccessorNode = pRNode;
+
+    while (nullptr != pSuccessorNode->GetLeftNode())
+    {
+        pSuccessorParentNode = pSuccessorNode;
+        pSuccessorNode = pSuccessorNode->GetLeftNode();
+    }
+
+    /**
+     * The nodes between the node and its successor lose the
+     * successor from their sub-binary trees
+     */
+    std::vector<Node *> vPassedNodes;
+
+    if (IsAugmented())
+    {
+        for (Node *pNode = pRNode; pNode != pSuccessorNode; pNode = pNode->GetLeftNode())
+        {
+            vPassedNodes.push_back(pNode);
+        }
+    }
+
+    if (pSuccessorParentNode != ipNode)
+    {
+        pSuccessorParentNode->SetLeftNode(pSuccessorNode->GetRightNode());
+        pSuccessorNode->SetRightNode(pRNode);
+    }
+
+    pSuccessorNode->SetLeftNode(pLNode);
+
+    UpdateAugmentations(vPassedNodes);
+    UpdateAugmentation(pSuccessorNode);
+
+    ReplaceChild(ipParentNode, ipNode, pSuccessorNode);
+}
+
+//-------------------------------------------------------------------
+Node *BinaryTree::RotateChildUp(Node *ipParentNode,
+                                Node *ipNode,
+                                bool ibRight)
+{
+    Node *pChildNode = ipNode->GetChildNode(ibRight);
+
+    ipNode->SetChildNode(ibRight, pChildNode->GetChildNode(!ibRight));
+    pChildNode->SetChildNode(!ibRight, ipNode);
+
+    UpdateAugmentation(ipNode);
+    UpdateAugmentation(pChildNode);
+
+    ReplaceChild(ipParentNode, ipNode, pChildNode);
+
+    return pChildNode;
+}
+
+//-------------------------------------------------------------------
+Node *BinaryTree::SplayBinarySearchTree(Node *ipRootNode,
+                                        int inData)
+{
+    if (nullptr == ipRootNode)
+    {
+        return nullptr;
+    }
+
+    /**
+     * The header collects the left tree as its right child and the
+     * right tree as its left child. The ends are the largest node of
+     * the left tree (index 0) and the smallest of the right tree
+     * (index 1), where the next passed node is hung.
+     */
+    Node objHeaderNode;
+    Node *apTreeEndNodes[2] = {&objHeaderNode, &objHeaderNode};
+
+    /**
+     * Nodes hung off the left and right trees, whose sizes are only
+     * known once both trees are reassembled
+     */
+    std::vector<Node *> vPassedNodes;
+
+    Node *pNode = ipRootNode;
+
+    while (inData != pNode->GetData())
+    {
+        const bool bRight = (inData > pNode->GetData());
+
+        Node *pChildNode = pNode->GetChildNode(bRight);
+
+        if (nullptr == pChildNode)
+        {
+            break;
+        }
+
+        if ((inData != pChildNode->GetData()) && (bRight == (inData > pChildNode->GetData())))
+        {
+            /**
+             * Zig-zig, rotate the child up before passing it
+             */
+            pNode->SetChildNode(bRight, pChildNode->GetChildNode(!bRight));
+            pChildNode->SetChildNode(!bRight, pNode);
+
+            UpdateAugmentation(pNode);
+
+            pNode = pChildNode;
+
+            if (nullptr == pNode->GetChildNode(bRight))
+            {
+                break;
+            }
+        }
+
+        apTreeEndNodes[!bRight]->SetChildNode(bRight, pNode);
+        apTreeEndNodes[!bRight] = pNode;
+
+        if (IsAugmented())
+        {
+            vPassedNodes.push_back(pNode);
+        }
+
+        pNode = pNode->GetChildNode(bRight);
+    }
+
+    apTreeEndNodes[0]->SetRightNode(pNode->GetLeftNode());
+    apTreeEndNodes[1]->SetLeftNode(pNode->GetRightNode());
+
+    UpdateAugmentations(vPassedNodes);
+
+    pNode->SetLeftNode(objHeaderNode.GetRightNode());
+    pNode->SetRightNode(objHeaderNode.GetLeftNode());
+
+    UpdateAugmentation(pNode);
+
+    return pNode;
+}
+
+//-------------------------------------------------------------------
+Node *BinaryTree::RebuildSubBinarySearchTree(Node *ipRootNode)
+{
+    if (nullptr == ipRootNode)
+    {
+        return nullptr;
+    }
+
+    Node objHeaderNode;
+
+    objHeaderNode.SetRightNode(ipRootNode);
+
+    /**
+     * Tree to vine, rotating every left child up until the nodes
+     * form a chain of right children in in-order
+     */
+    Node *pTailNode = &objHeaderNode;
+    Node *pRestNode = ipRootNode;
+
+    int nCount(0);
+
+    while (nullptr != pRestNode)
+    {
+        if (nullptr == pRestNode->GetLeftNode())
+        {
+            pTailNode = pRestNode;
+            pRestNode = pRestNode->GetRightNode();
+
+            ++nCount;
+        }
+        else
+        {
+            pRestNode = RotateChildUp(pTailNode, pRestNode, false);
+        }
+    }
+
+    /**
+     * Vine to tree. The first round only folds the nodes which do not
+     * fit in the full levels, each following round halves the vine.
+     */
+    int nFolds = nCount + 1 - (int)(std::bit_floor((unsigned int)(nCount + 1)));
+    int nRemaining = nCount - nFolds;
+
+    while (true)
+    {
+        Node *pScannerNode = &objHeaderNode;
+
+        for (int nIdx = 0; nIdx < nFolds; ++nIdx)
+        {
+            pScannerNode = RotateChildUp(pScannerNode, pScannerNode->GetRightNode(), true);
+        }
+
+        if (1 >= nRemaining)
+        {
+            break;
+        }
+
+        nRemaining /= 2;
+        nFolds = nRemaining;
+    }
+
+    return objHeaderNode.GetRightNode();
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::RebuildAtScapegoat(Node *ipNode,
+                                    const std::vector<Node *> &ivPath)
+{
+    /**
+     * Climb with the size of the sub-binary tree climbed from, only
+     * the sibling sub-binary trees need counting
+     */
+    Node *pChildNode = ipNode;
+
+    int nChildCount(1);
+
+    for (int nIdx = (int)(ivPath.size()) - 1; 0 <= nIdx; --nIdx)
+    {
+        Node *pNode = ivPath[nIdx];
+
+        int nCount = nChildCount + 1 + CountNodesOfSubBinaryTree(pNode->GetChildNode(pNode->GetLeftNode() == pChildNode));
+
+        if ((3 * nChildCount) > (2 * nCount))
+        {
+            Node *pParentNode = (0 < nIdx) ? ivPath[nIdx - 1] : nullptr;
+
+            ReplaceChild(pParentNode, pNode, RebuildSubBinarySearchTree(pNode));
+            return;
+        }
+
+        pChildNode = pNode;
+        nChildCount = nCount;
+    }
+}
+
+//-------------------------------------------------------------------
+std::uint64_t BinaryTree::TreapPriority(int inData)
+{
+    /**
+     * SplitMix64 finaliser, with another constant than the Bloom
+     * filter so that the priorities do not follow its blocks
+     */
+    std::uint64_t nHash = (std::uint32_t)(inData) + 0xD1B54A32D192ED03ull;
+
+    nHash = (nHash ^ (nHash >> 30)) * 0xBF58476D1CE4E5B9ull;
+    nHash = (nHash ^ (nHash >> 27)) * 0x94D049BB133111EBull;
+
+    return nHash ^ (nHash >> 31);
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::RebalanceAfterTreapInsertion(Node *ipNode,
+                                              const std::vector<Node *> &ivPath,
+                                              int &onIntactCount)
+{
+    const std::uint64_t nPriority = TreapPriority(ipNode->GetData());
+
+    /**
+     * Each rotation lifts the node one level, making the next
+     * ancestor on the path its parent
+     */
+    int nIdx = (int)(ivPath.size()) - 1;
+
+    for (; (0 <= nIdx) && (TreapPriority(ivPath[nIdx]->GetData()) < nPriority); --nIdx)
+    {
+        Node *pParentNode = (0 < nIdx) ? ivPath[nIdx - 1] : nullptr;
+
+        RotateChildUp(pParentNode, ivPath[nIdx], ivPath[nIdx]->GetRightNode() == ipNode);
+    }
+
+    onIntactCount = nIdx + 1;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::SplitSubBinarySearchTree(Node *ipRootNode,
+                                          int inData,
+                                          bool ibEqualToLeft,
+                                          Node *&opLeftNode,
+                                          Node *&opRightNode)
+{
+    /**
+     * Each node on the search path goes to the side of its data and
+     * takes over as its child the part split off the sub-binary tree
+     * towards the other side. The header node collects the left part
+     * as its right child and the right part as its left child.
+     */
+    Node objHeaderNode;
+    Node *apTreeEndNodes[2] = {&objHeaderNode, &objHeaderNode};
+
+    std::vector<Node *> vPassedNodes;
+
+    Node *pNode = ipRootNode;
+
+    while (nullptr != pNode)
+    {
+        const bool bLeft = (pNode->GetData() < inData) || (ibEqualToLeft && (pNode->GetData() == inData));
+
+        apTreeEndNodes[bLeft ? 0 : 1]->SetChildNode(bLeft, pNode);
+        apTreeEndNodes[bLeft ? 0 : 1] = pNode;
+
+        if (IsAugmented())
+        {
+            vPassedNodes.push_back(pNode);
+        }
+
+        pNode = pNode->GetChildNode(bLeft);
+    }
+
+    apTreeEndNodes[0]->SetRightNode(nullptr);
+    apTreeEndNodes[1]->SetLeftNode(nullptr);
+
+    UpdateAugmentations(vPassedNodes);
+
+    opLeftNode = objHeaderNode.GetRightNode();
+    opRightNode = objHeaderNode.GetLeftNode();
+}
+
+//-------------------------------------------------------------------
+Node *BinaryTree::JoinTreap(Node *ipLeftNode,
+                            Node *ipRightNode)
+{
+    /**
+     * Zip the right spine of the left treap with the left spine of
+     * the right treap by priority, below a header node
+     */
+    Node objHeaderNode;
+    Node *pTreeEndNode = &objHeaderNode;
+
+    std::vector<Node *> vPassedNodes;
+
+    /**
+     * Side of the last node linked which is still to be filled
+     */
+    bool bRight(false);
+
+    while ((nullptr != ipLeftNode) && (nullptr != ipRightNode))
+    {
+        if (TreapPriority(ipLeftNode->GetData()) >= TreapPriority(ipRightNode->GetData()))
+        {
+            pTreeEndNode->SetChildNode(bRight, ipLeftNode);
+            pTreeEndNode = ipLeftNode;
+            bRight = true;
+
+            if (IsAugmented())
+            {
+                vPassedNodes.push_back(ipLeftNode);
+            }
+
+            ipLeftNode = ipLeftNode->GetRightNode();
+        }
+        else
+        {
+            pTreeEndNode->SetChildNode(bRight, ipRightNode);
+            pTreeEndNode = ipRightNode;
+            bRight = false;
+
+            if (IsAugmented())
+            {
+                vPassedNodes.push_back(ipRightNode);
+            }
+
+            ipRightNode = ipRightNode->GetLeftNode();
+        }
+    }
+
+    pTreeEndNode->SetChildNode(bRight, (nullptr != ipLeftNode) ? ipLeftNode : ipRightNode);
+
+    UpdateAugmentations(vPassedNodes);
+
+    return objHeaderNode.GetLeftNode();
+}
+
+//-------------------------------------------------------------------
+Node *BinaryTree::JoinSubBinarySearchTrees(Node *ipLeftNode,
+                                           Node *ipRightNode)
+{
+    /**
+     * The smallest node of the right part is unlinked and becomes the
+     * root node above both parts
+     */
+    std::vector<Node *> vPath;
+
+    Node *pMiddleNode = ipRightNode;
+
+    while (nullptr != pMiddleNode->GetLeftNode())
+    {
+        vPath.push_back(pMiddleNode);
+        pMiddleNode = pMiddleNode->GetLeftNode();
+    }
+
+    if (vPath.empty())
+    {
+        ipRightNode = pMiddleNode->GetRightNode();
+    }
+    else
+    {
+        vPath.back()->SetLeftNode(pMiddleNode->GetRightNode());
+    }
+
+    UpdateAugmentations(vPath);
+
+    pMiddleNode->SetLeftNode(ipLeftNode);
+    pMiddleNode->SetRightNode(ipRightNode);
+
+    UpdateAugmentation(pMiddleNode);
+
+    return pMiddleNode;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::SplitRedBlackTree(Node *ipRootNode,
+                                   int inData,
+                                   Node *&opLeftNode,
+                                   Node *&opRightNode)
+{
+    /**
+     * Each node on the search path goes to the side of its data along
+     * with its sub-binary tree on that side, whose black height when
+     * taken as a red-black tree of its own is noted on the way down
+     */
+    std::vector<std::pair<Node *, int>> avSideNodes[2];
+
+    int nBlackHeight = RetrieveBlackHeight(ipRootNode);
+
+    for (Node *pNode = ipRootNode; nullptr != pNode;)
+    {
+        const bool bRight = (pNode->GetData() >= inData);
+        const int nChildBlackHeight = nBlackHeight - (pNode->IsRed() ? 0 : 1);
+
+        Node *pOuterNode = pNode->GetChildNode(bRight);
+
+        avSideNodes[bRight ? 1 : 0].push_back({pNode, nChildBlackHeight + (((nullptr != pOuterNode) && pOuterNode->IsRed()) ? 1 : 0)});
+
+        nBlackHeight = nChildBlackHeight;
+        pNode = pNode->GetChildNode(!bRight);
+    }
+
+    /**
+     * Both parts are joined from the deepest node up. The black heights
+     * of the parts joined grow along the path, so all joins together
+     * take O(log n).
+     */
+    for (int nSide = 0; nSide < 2; ++nSide)
+    {
+        Node *pTreeNode = nullptr;
+        int nTreeBlackHeight(0);
+
+        for (auto itEntry = avSideNodes[nSide].rbegin(); itEntry != avSideNodes[nSide].rend(); ++itEntry)
+        {
+            Node *pNode = itEntry->first;
+            Node *pOuterNode = pNode->GetChildNode(1 == nSide);
+
+            pNode->SetLeftNode(nullptr);
+            pNode->SetRightNode(nullptr);
+
+            if (0 == nSide)
+            {
+                pTreeNode = JoinRedBlackTrees(pOuterNode, itEntry->second, pNode, pTreeNode, nTreeBlackHeight, nTreeBlackHeight);
+            }
+            else
+            {
+                pTreeNode = JoinRedBlackTrees(pTreeNode, nTreeBlackHeight, pNode, pOuterNode, itEntry->second, nTreeBlackHeight);
+            }
+        }
+
+        ((0 == nSide) ? opLeftNode : opRightNode) = pTreeNode;
+    }
+}
+
+//-------------------------------------------------------------------
+Node *BinaryTree::JoinRedBlackTrees(Node *ipLeftNode,
+                                    int inLeftBlackHeight,
+                                    Node *ipMiddleNode,
+                                    Node *ipRightNode,
+                                    int inRightBlackHeight,
+                                    int &onBlackHeight)
+{
+    for (Node *pNode : {ipLeftNode, ipRightNode})
+    {
+        if (nullptr != pNode)
+        {
+            pNode->SetRed(false);
+        }
+    }
+
+    if (inLeftBlackHeight == inRightBlackHeight)
+    {
+        ipMiddleNode->SetLeftNode(ipLeftNode);
+        ipMiddleNode->SetRightNode(ipRightNode);
+        ipMiddleNode->SetRed(false);
+
+        UpdateAugmentation(ipMiddleNode);
+
+        onBlackHeight = inLeftBlackHeight + 1;
+
+        return ipMiddleNode;
+    }
+
+    /**
+     * Descend the facing spine of the taller red-black tree to a black
+     * node as high in black nodes as the shorter one, and link the
+     * middle node in its place as a red node above both. The
+     * rebalancing after an insertion then fixes a red parent.
+     */
+    const bool bRight = (inLeftBlackHeight > inRightBlackHeight);
+
+    Node *pTallerNode = bRight ? ipLeftNode : ipRightNode;
+    Node *pShorterNode = bRight ? ipRightNode : ipLeftNode;
+
+    const int nShorterBlackHeight = std::min(inLeftBlackHeight, inRightBlackHeight);
+
+    int nBlackHeight = std::max(inLeftBlackHeight, inRightBlackHeight);
+
+    std::vector<Node *> vPath;
+
+    Node *pNode = pTallerNode;
+
+    while ((nullptr != pNode) && (pNode->IsRed() || (nBlackHeight > nShorterBlackHeight)))
+    {
+        vPath.push_back(pNode);
+
+        if (!pNode->IsRed())
+        {
+            --nBlackHeight;
+        }
+
+        pNode = pNode->GetChildNode(bRight);
+    }
+
+    ipMiddleNode->SetChildNode(!bRight, pNode);
+    ipMiddleNode->SetChildNode(bRight, pShorterNode);
+
+    vPath.back()->SetChildNode(bRight, ipMiddleNode);
+
+    UpdateAugmentation(ipMiddleNode);
+    UpdateAugmentations(vPath);
+
+    _pRootNode = pTallerNode;
+
+    int nIntactCount(0);
+
+    const bool bGrown = RebalanceAfterRedBlackInsertion(ipMiddleNode, vPath, nIntactCount);
+
+    if (_bSubtreeHeights)
+    {
+        UpdateAugmentations(vPath);
+    }
+
+    onBlackHeight = std::max(inLeftBlackHeight, inRightBlackHeight) + (bGrown ? 1 : 0);
+
+    return _pRootNode;
+}
+
+//-------------------------------------------------------------------
+Node *BinaryTree::DetachSmallestRedBlackNode()
+{
+    std::vector<Node *> vPath;
+
+    Node *pNode = _pRootNode;
+
+    while (nullptr != pNode->GetLeftNode())
+    {
+        vPath.push_back(pNode);
+        pNode = pNode->GetLeftNode();
+    }
+
+    RemoveNodeFromRedBlackTree(pNode, vPath);
+
+    if (_bSubtreeHeights)
+    {
+        UpdateAugmentations(vPath);
+    }
+
+    pNode->SetRightNode(nullptr);
+
+    return pNode;
+}
+
+//-------------------------------------------------------------------
+int BinaryTree::RetrieveBlackHeight(const Node *ipNode)
+{
+    int nBlackHeight(0);
+
+    for (const Node *pNode = ipNode; nullptr != pNode; pNode = pNode->GetLeftNode())
+    {
+        if (!pNode->IsRed())
+        {
+            ++nBlackHeight;
+        }
+    }
+
+    return nBlackHeight;
+}
+
+//-------------------------------------------------------------------
+Node *BinaryTree::UnionTreaps(Node *ipFirstNode,
+                              Node *ipSecondNode,
+                              int inParallelDepth,
+                              int &onRemovedCount)
+{
+    onRemovedCount = 0;
+
+    if ((nullptr == ipFirstNode) || (nullptr == ipSecondNode))
+    {
+        return (nullptr != ipFirstNode) ? ipFirstNode : ipSecondNode;
+    }
+
+    /**
+     * The root node of higher priority stays the root node, the other
+     * treap is split at its data into the smaller, equal and larger
+     * data
+     */
+    if (TreapPriority(ipFirstNode->GetData()) < TreapPriority(ipSecondNode->GetData()))
+    {
+        std::swap(ipFirstNode, ipSecondNode);
+    }
+
+    const int nData = ipFirstNode->GetData();
+
+    Node *pLNode = nullptr;
+    Node *pENode = nullptr;
+    Node *pRNode = nullptr;
+
+    SplitSubBinarySearchTree(ipSecondNode, nData, false, pLNode, pRNode);
+    SplitSubBinarySearchTree(pRNode, nData, true, pENode, pRNode);
+
+    if (nullptr != pENode)
+    {
+        if (_bMultiset)
+        {
+            ipFirstNode->SetCount(ipFirstNode->GetCount() + pENode->GetCount());
+        }
+
+        onRemovedCount += FreeSubBinaryTree(pENode);
+    }
+
+    int nLRemovedCount(0);
+    int nRRemovedCount(0);
+
+    if (IsWorthForking(ipFirstNode->GetLeftNode(), pLNode, inParallelDepth))
+    {
+        ForkJoinPool::RetrieveInstance().Invoke([&]()
+                                                { pLNode = UnionTreaps(ipFirstNode->GetLeftNode(), pLNode, inParallelDepth - 1, nLRemovedCount); },
+                                                [&]()
+                                                { pRNode = UnionTreaps(ipFirstNode->GetRightNode(), pRNode, inParallelDepth - 1, nRRemovedCount); });
+    }
+    else
+    {
+        pLNode = UnionTreaps(ipFirstNode->GetLeftNode(), pLNode, 0, nLRemovedCount);
+        pRNode = UnionTreaps(ipFirstNode->GetRightNode(), pRNode, 0, nRRemovedCount);
+    }
+
+    ipFirstNode->SetLeftNode(pLNode);
+    ipFirstNode->SetRightNode(pRNode);
+
+    UpdateAugmentation(ipFirstNode);
+
+    onRemovedCount += nLRemovedCount + nRRemovedCount;
+
+    return ipFirstNode;
+}
+
+//-------------------------------------------------------------------
+Node *BinaryTree::IntersectTreaps(Node *ipFirstNode,
+                                  Node *ipSecondNode,
+                                  int inParallelDepth,
+                                  int &onRemovedCount)
+{
+    onRemovedCount = 0;
+
+    if ((nullptr == ipFirstNode) || (nullptr == ipSecondNode))
+    {
+        onRemovedCount = FreeSubBinaryTree(ipFirstNode) + FreeSubBinaryTree(ipSecondNode);
+        return nullptr;
+    }
+
+    if (TreapPriority(ipFirstNode->GetData()) < TreapPriority(ipSecondNode->GetData()))
+    {
+        std::swap(ipFirstNode, ipSecondNode);
+    }
+
+    const int nData = ipFirstNode->GetData();
+
+    Node *pLNode = nullptr;
+    Node *pENode = nullptr;
+    Node *pRNode = nullptr;
+
+    SplitSubBinarySearchTree(ipSecondNode, nData, false, pLNode, pRNode);
+    SplitSubBinarySearchTree(pRNode, nData, true, pENode, pRNode);
+
+    const bool bKeep = (nullptr != pENode);
+
+    if (bKeep)
+    {
+        if (_bMultiset)
+        {
+            ipFirstNode->SetCount(std::min(ipFirstNode->GetCount(), pENode->GetCount()));
+        }
+
+        onRemovedCount += FreeSubBinaryTree(pENode);
+    }
+
+    int nLRemovedCount(0);
+    int nRRemovedCount(0);
+
+    if (IsWorthForking(ipFirstNode->GetLeftNode(), pLNode, inParallelDepth))
+    {
+        ForkJoinPool::RetrieveInstance().Invoke([&]()
+                                                { pLNode = IntersectTreaps(ipFirstNode->GetLeftNode(), pLNode, inParallelDepth - 1, nLRemovedCount); },
+                                                [&]()
+                                                { pRNode = IntersectTreaps(ipFirstNode->GetRightNode(), pRNode, inParallelDepth - 1, nRRemovedCount); });
+    }
+    else
+    {
+        pLNode = IntersectTreaps(ipFirstNode->GetLeftNode(), pLNode, 0, nLRemovedCount);
+        pRNode = IntersectTreaps(ipFirstNode->GetRightNode(), pRNode, 0, nRRemovedCount);
+    }
+
+    onRemovedCount += nLRemovedCount + nRRemovedCount;
+
+    if (!bKeep)
+    {
+        delete ipFirstNode;
+        ++onRemovedCount;
+
+        return JoinTreap(pLNode, pRNode);
+    }
+
+    ipFirstNode->SetLeftNode(pLNode);
+    ipFirstNode->SetRightNode(pRNode);
+
+    UpdateAugmentation(ipFirstNode);
+
+    return ipFirstNode;
+}
+
+//-------------------------------------------------------------------
+Node *BinaryTree::SubtractTreaps(Node *ipFirstNode,
+                                 Node *ipSecondNode,
+                                 int inParallelDepth,
+                                 int &onRemovedCount)
+{
+    onRemovedCount = 0;
+
+    if ((nullptr == ipFirstNode) || (nullptr == ipSecondNode))
+    {
+        onRemovedCount = FreeSubBinaryTree(ipSecondNode);
+        return ipFirstNode;
+    }
+
+    /**
+     * Unlike the union and the intersection the operands are not
+     * symmetric, the second treap is always split at the root node of
+     * the first
+     */
+    const int nData = ipFirstNode->GetData();
+
+    Node *pLNode = nullptr;
+    Node *pENode = nullptr;
+    Node *pRNode = nullptr;
+
+    SplitSubBinarySearchTree(ipSecondNode, nData, false, pLNode, pRNode);
+    SplitSubBinarySearchTree(pRNode, nData, true, pENode, pRNode);
+
+    bool bKeep(true);
+
+    if (nullptr != pENode)
+    {
+        bKeep = (_bMultiset && (ipFirstNode->GetCount() > pENode->GetCount()));
+
+        if (bKeep)
+        {
+            ipFirstNode->SetCount(ipFirstNode->GetCount() - pENode->GetCount());
+        }
+
+        onRemovedCount += FreeSubBinaryTree(pENode);
+    }
+
+    int nLRemovedCount(0);
+    int nRRemovedCount(0);
+
+    if (IsWorthForking(ipFirstNode->GetLeftNode(), pLNode, inParallelDepth))
+    {
+        ForkJoinPool::RetrieveInstance().Invoke([&]()
+                                                { pLNode = SubtractTreaps(ipFirstNode->GetLeftNode(), pLNode, inParallelDepth - 1, nLRemovedCount); },
+                                                [&]()
+                                                { pRNode = SubtractTreaps(ipFirstNode->GetRightNode(), pRNode, inParallelDepth - 1, nRRemovedCount); });
+    }
+    else
+    {
+        pLNode = SubtractTreaps(ipFirstNode->GetLeftNode(), pLNode, 0, nLRemovedCount);
+        pRNode = SubtractTreaps(ipFirstNode->GetRightNode(), pRNode, 0, nRRemovedCount);
+    }
+
+    onRemovedCount += nLRemovedCount + nRRemovedCount;
+
+    if (!bKeep)
+    {
+        delete ipFirstNode;
+        ++onRemovedCount;
+
+        return JoinTreap(pLNode, pRNode);
+    }
+
+    ipFirstNode->SetLeftNode(pLNode);
+    ipFirstNode->SetRightNode(pRNode);
+
+    UpdateAugmentation(ipFirstNode);
+
+    return ipFirstNode;
+}
+
+//-------------------------------------------------------------------
+int BinaryTree::FreeSubBinaryTree(Node *ipNode)
+{
+    if (nullptr == ipNode)
+    {
+        return 0;
+    }
+
+    int nCount = CountNodesOfSubBinaryTree(ipNode);
+
+    RemoveChildren(ipNode);
+
+    delete ipNode;
+
+    return nCount;
+}
+
+//-------------------------------------------------------------------
+bool BinaryTree::IsTreapOperand(const BinaryTree *ipBinaryTree) const
+{
+    if (!IsCompatibleOperand(ipBinaryTree))
+    {
+        return false;
+    }
+
+    if (BALANCING_TREAP != _eBalancingMode)
+    {
+        std::cout << "ERR<<Both binary trees must be in treap mode.>>" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+//-------------------------------------------------------------------
+int BinaryTree::RetrieveParallelDepth(int inNodeCount) const
+{
+    const int nThreadDepth = std::bit_width(std::max(std::thread::hardware_concurrency(), 1u)) - 1;
+    const int nGrainDepth = std::bit_width((unsigned int)(inNodeCount / _nParallelGrainSize)) - 1;
+
+    return std::max(0, std::min(nThreadDepth, nGrainDepth));
+}
+
+//-------------------------------------------------------------------
+bool BinaryTree::IsWorthForking(const Node *ipFirstNode,
+                                const Node *ipSecondNode,
+                                int inParallelDepth) const
+{
+    if (0 >= inParallelDepth)
+    {
+        return false;
+    }
+
+    /**
+     * Without sizes the depth alone bounds the tasks, from the node
+     * count of both treaps
+     */
+    if (!_bSubtreeSizes)
+    {
+        return true;
+    }
+
+    return (RetrieveSubtreeSize(ipFirstNode) + RetrieveSubtreeSize(ipSecondNode)) >= _nParallelGrainSize;
+}
+
+//-------------------------------------------------------------------
+bool BinaryTree::IsCompatibleOperand(const BinaryTree *ipBinaryTree) const
+{
+    if ((nullptr == ipBinaryTree) || (this == ipBinaryTree))
+    {
+        std::cout << "ERR<<Other binary tree must be a distinct binary tree.>>" << std::endl;
+        return false;
+    }
+
+    if ((!_bOrderedTree) || (!ipBinaryTree->_bOrderedTree))
+    {
+        std::cout << "ERR<<Both binary trees must be binary search trees.>>" << std::endl;
+        return false;
+    }
+
+    if (_eBalancingMode != ipBinaryTree->_eBalancingMode)
+    {
+        std::cout << "ERR<<Both binary trees must be in the same balancing mode.>>" << std::endl;
+        return false;
+    }
+
+    /**
+     * Sub-binary trees of the other binary tree are linked in
+     * unchanged, so they must already carry their augmentations
+     */
+    if (_bRangeAggregates && (!ipBinaryTree->_bRangeAggregates))
+    {
+        std::cout << "ERR<<Other binary tree must carry range aggregates as well.>>" << std::endl;
+        return false;
+    }
+
+    if (_bSubtreeSizes && (!ipBinaryTree->_bSubtreeSizes))
+    {
+        const_cast<BinaryTree *>(ipBinaryTree)->EnableOrderStatistics();
+    }
+
+    if (_bSubtreeHeights && (!ipBinaryTree->_bSubtreeHeights))
+    {
+        const_cast<BinaryTree *>(ipBinaryTree)->EnableSubtreeHeights();
+    }
+
+    return true;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::AdoptBinaryTree(Node *ipRootNode,
+                                 int inNodeCount,
+                                 BinaryTree *&iopBinaryTree)
+{
+    _pRootNode = ipRootNode;
+    _nNodeCount = inNodeCount;
+
+    /**
+     * The nodes now belong to this binary tree, only the binary tree
+     * object itself is left to delete
+     */
+    iopBinaryTree->_pRootNode = nullptr;
+
+    delete iopBinaryTree;
+    iopBinaryTree = nullptr;
+
+    ResetDerivedState();
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::ResetDerivedState()
+{
+    _bCompleteTree = (1 >= _nNodeCount);
+    _bOrderedTree = true;
+
+    /**
+     * A scapegoat tree measures its shrinking from its new size
+     */
+    _nMaxNodeCount = _nNodeCount;
+
+    DisableNodeIndex();
+
+    ClearFingerPath();
+
+    /**
+     * Only a dense range walks the nodes to fill the bitmap
+     */
+    RebuildDenseKeyBitmap();
+
+    if (nullptr != _pBloomFilter)
+    {
+        RebuildBloomFilter();
+    }
+
+    if (nullptr != _pRadixIndex)
+    {
+        EnableRadixIndex();
+    }
+}
+
+//-------------------------------------------------------------------
+bool BinaryTree::RebalanceAfterRedBlackInsertion(Node *ipNode,
+                                                 const std::vector<Node *> &ivPath,
+                                                 int &onIntactCount)
+{
+    ipNode->SetRed(true);
+
+    onIntactCount = (int)(ivPath.size());
+
+    Node *pNode = ipNode;
+
+    /**
+     * A red parent is never the root node, so it has a parent too
+     */
+    int nIdx = (int)(ivPath.size()) - 1;
+
+    while ((0 < nIdx) && (ivPath[nIdx]->IsRed()))
+    {
+        Node *pParentNode = ivPath[nIdx];
+        Node *pGrandParentNode = ivPath[nIdx - 1];
+
+        const bool bRight = (pGrandParentNode->GetRightNode() == pParentNode);
+
+        Node *pUncleNode = pGrandParentNode->GetChildNode(!bRight);
+
+        if ((nullptr != pUncleNode) && (pUncleNode->IsRed()))
+        {
+            /**
+             * Push the red up to the grandparent and continue from there
+             */
+            pParentNode->SetRed(false);
+            pUncleNode->SetRed(false);
+            pGrandParentNode->SetRed(true);
+
+            pNode = pGrandParentNode;
+            nIdx -= 2;
+
+            continue;
+        }
+
+        /**
+         * An inner grandchild is first rotated to the outside, then the
+         * grandparent is rotated down below the parent
+         */
+        if (pParentNode->GetChildNode(!bRight) == pNode)
+        {
+            pParentNode = RotateChildUp(pGrandParentNode, pParentNode, !bRight);
+        }
+
+        RotateChildUp((1 < nIdx) ? ivPath[nIdx - 2] : nullptr, pGrandParentNode, bRight);
+
+        onIntactCount = nIdx - 1;
+
+        pParentNode->SetRed(false);
+        pGrandParentNode->SetRed(true);
+
+        break;
+    }
+
+    const bool bRedRootNode = _pRootNode->IsRed();
+
+    _pRootNode->SetRed(false);
+
+    return bRedRootNode;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::RemoveNodeFromRedBlackTree(Node *ipNode,
+                                            std::vector<Node *> &iovPath)
+{
+    if ((nullptr != ipNode->GetLeftNode()) && (nullptr != ipNode->GetRightNode()))
+    {
+        /**
+         * Swap the node with its in-order successor, which has no left
+         * child. The path then leads to the new place of the node.
+         */
+        const int nNodeIdx = (int)(iovPath.size());
+
+        iovPath.push_back(ipNode);
+
+        Node *pSuccessorNode = ipNode->GetRightNode();
+
+        while (nullptr != pSuccessorNode->GetLeftNode())
+        {
+            iovPath.push_back(pSuccessorNode);
+            pSuccessorNode = pSuccessorNode->GetLeftNode();
+        }
+
+        Node *pLNode = ipNode->GetLeftNode();
+        Node *pRNode = ipNode->GetRightNode();
+        Node *pSuccessorRNode = pSuccessorNode->GetRightNode();
+
+        if (pSuccessorNode == pRNode)
+        {
+            pSuccessorNode->SetRightNode(ipNode);
+        }
+        else
+        {
+            iovPath.back()->SetLeftNode(ipNode);
+            pSuccessorNode->SetRightNode(pRNode);
+        }
+
+        pSuccessorNode->SetLeftNode(pLNode);
+
+        ipNode->SetLeftNode(nullptr);
+        ipNode->SetRightNode(pSuccessorRNode);
+
+        ReplaceChild((0 < nNodeIdx) ? iovPath[nNodeIdx - 1] : nullptr, ipNode, pSuccessorNode);
+
+        const bool bRed = ipNode->IsRed();
+
+        ipNode->SetRed(pSuccessorNode->IsRed());
+        pSuccessorNode->SetRed(bRed);
+
+        iovPath[nNodeIdx] = pSuccessorNode;
+    }
+
+    Node *pChildNode = (nullptr != ipNode->GetLeftNode()) ? ipNode->GetLeftNode() : ipNode->GetRightNode();
+    Node *pParentNode = iovPath.empty() ? nullptr : iovPath.back();
+
+    bool bRight = (nullptr != pParentNode) && (pParentNode->GetRightNode() == ipNode);
+
+    ReplaceChild(pParentNode, ipNode, pChildNode);
+
+    /**
+     * Every ancestor of the place the node is unlinked from loses it,
+     * the rotations below then keep the sizes and summaries
+     */
+    UpdateAugmentations(iovPath);
+
+    if (ipNode->IsRed())
+    {
+        return;
+    }
+
+    if ((nullptr != pChildNode) && (pChildNode->IsRed()))
+    {
+        pChildNode->SetRed(false);
+        return;
+    }
+
+    /**
+     * The side of the parent which lost the black node is one black
+     * node short. Fix it locally or move the shortage up a level.
+     */
+    int nIdx = (int)(iovPath.size()) - 1;
+
+    while (0 <= nIdx)
+    {
+        pParentNode = iovPath[nIdx];
+
+        Node *pGrandParentNode = (0 < nIdx) ? iovPath[nIdx - 1] : nullptr;
+        Node *pSiblingNode = pParentNode->GetChildNode(!bRight);
+
+        if (pSiblingNode->IsRed())
+        {
+            /**
+             * Rotate the red sibling up, so the sibling becomes black
+             * and the parent red
+             */
+            pSiblingNode->SetRed(false);
+            pParentNode->SetRed(true);
+
+            RotateChildUp(pGrandParentNode, pParentNode, !bRight);
+
+            /**
+             * The sibling joins the path above the parent, whose
+             * rotations below change its height
+             */
+            iovPath.insert(iovPath.begin() + nIdx, pSiblingNode);
+            ++nIdx;
+
+            pGrandParentNode = pSiblingNode;
+            pSiblingNode = pParentNode->GetChildNode(!bRight);
+        }
+
+        Node *pNearNode = pSiblingNode->GetChildNode(bRight);
+        Node *pFarNode = pSiblingNode->GetChildNode(!bRight);
+
+        const bool bNearRed = (nullptr != pNearNode) && (pNearNode->IsRed());
+        const bool bFarRed = (nullptr != pFarNode) && (pFarNode->IsRed());
+
+        if ((!bNearRed) && (!bFarRed))
+        {
+            pSiblingNode->SetRed(true);
+
+            if (pParentNode->IsRed())
+            {
+                pParentNode->SetRed(false);
+                return;
+            }
+
+            /**
+             * A red sibling left the parent red, so the shortage only
+             * moves up past a parent which was not rotated
+             */
+            if (nullptr != pGrandParentNode)
+            {
+                bRight = (pGrandParentNode->GetRightNode() == pParentNode);
+            }
+
+            --nIdx;
+            continue;
+        }
+
+        if (!bFarRed)
+        {
+            pNearNode->SetRed(false);
+            pSiblingNode->SetRed(true);
+
+            pSiblingNode = RotateChildUp(pParentNode, pSiblingNode, bRight);
+            pFarNode = pSiblingNode->GetChildNode(!bRight);
+        }
+
+        pSiblingNode->SetRed(pParentNode->IsRed());
+        pParentNode->SetRed(false);
+        pFarNode->SetRed(false);
+
+        RotateChildUp(pGrandParentNode, pParentNode, !bRight);
+
+        return;
+    }
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::RemoveNodeFromBinaryTree(Node *ipNode,
+                                          Node *ipParentNode,
+                                          int inDepth)
+{
+    /**
+     * The last node in level order is a leaf. It is detached and
+     * takes the place of the removed node, which keeps a complete
+     * binary tree complete.
+     */
+    Node *pLastNode = nullptr;
+    Node *pLastParentNode = nullptr;
+
+    if (_bCompleteTree)
+    {
+        int nLastSlot = _nNodeCount - 1;
+
+        pLastNode = RetrieveNodeAtSlot(nLastSlot);
+        pLastParentNode = (0 < nLastSlot) ? RetrieveNodeAtSlot((nLastSlot - 1) / 2) : nullptr;
+    }
+    else
+    {
+        std::queue<std::pair<Node *, Node *>> qNodes;
+
+        qNodes.emplace(_pRootNode, nullptr);
+
+        while (!qNodes.empty())
+        {
+            std::tie(pLastNode, pLastParentNode) = qNodes.front();
+
+            qNodes.pop();
+
+            if (nullptr != pLastNode->GetLeftNode())
+            {
+                qNodes.emplace(pLastNode->GetLeftNode(), pLastNode);
+            }
+
+            if (nullptr != pLastNode->GetRightNode())
+            {
+                qNodes.emplace(pLastNode->GetRightNode(), pLastNode);
+            }
+        }
+    }
+
+    ReplaceChild(pLastParentNode, pLastNode, nullptr);
+
+    int nPosition(0);
+
+    if (nullptr != _pNodeIndex)
+    {
+        NodeIndex::Entry *pEntry = _pNodeIndex->Find(ipNode->GetData(), ipNode);
+
+        if (nullptr != pEntry)
+        {
+            nPosition = pEntry->nPosition;
         }
-    }
 
-    std::cout << std::endl;
-}
+        _pNodeIndex->Remove(ipNode->GetData(), ipNode);
+    }
 
-//-------------------------------------------------------------------
-void BinaryTree::PrintNonLeafNodes()
-{
-    if (IsEmpty())
+    if (pLastNode == ipNode)
     {
         return;
     }
 
-    std::vector<Node *> vNodes;
-
-    RetrieveNonLeafNodesOfBinaryTreeNode(_pRootNode, vNodes);
+    pLastNode->SetLeftNode(ipNode->GetLeftNode());
+    pLastNode->SetRightNode(ipNode->GetRightNode());
 
-    std::cout << "Non-leaf nodes: ";
+    ReplaceChild(ipParentNode, ipNode, pLastNode);
 
-    for (auto pNode : vNodes)
+    if (nullptr != _pNodeIndex)
     {
-        if (nullptr != pNode)
+        NodeIndex::Entry *pEntry = _pNodeIndex->Find(pLastNode->GetData(), pLastNode);
+
+        if (nullptr != pEntry)
         {
-            std::cout << pNode->GetData() << " ";
+            pEntry->pParentNode = ipParentNode;
+            pEntry->nDepth = inDepth;
+            pEntry->nPosition = nPosition;
+        }
+
+        for (Node *pChildNode : {pLastNode->GetLeftNode(), pLastNode->GetRightNode()})
+        {
+            if ((nullptr != pChildNode) &&
+                (nullptr != (pEntry = _pNodeIndex->Find(pChildNode->GetData(), pChildNode))))
+            {
+                pEntry->pParentNode = pLastNode;
+            }
         }
     }
+}
 
-    std::cout << std::endl;
+//-------------------------------------------------------------------
+void BinaryTree::InvalidateCompleteTree()
+{
+    _bCompleteTree = false;
+
+    DisableNodeIndex();
 }
 
 //-------------------------------------------------------------------
-void BinaryTree::PrintBoundaryNodes()
+Node *BinaryTree::SearchInBinaryTree(Node *ipRootNode,
+                                     int inData,
+                                     std::vector<Node *> &ovPath)
 {
-    if (IsEmpty())
+    ovPath.clear();
+
+    Node *pNode = ipRootNode;
+
+    if ((nullptr != _pBloomFilter) && (_pRootNode == ipRootNode) && (!_pBloomFilter->MayContain(inData)))
     {
-        return;
+        return nullptr;
     }
 
-    std::vector<Node *> vNodes;
+    if ((nullptr != _pRadixIndex) && (_pRootNode == ipRootNode) && (nullptr == _pRadixIndex->Find(inData)))
+    {
+        return nullptr;
+    }
 
-    vNodes.push_back(_pRootNode);
+    if ((nullptr != _pNodeIndex) && (_pRootNode == ipRootNode))
+    {
+        /**
+         * Collect the ancestors by following the parent
+         * of each entry, deepest first
+         */
+        NodeIndex::Entry *pEntry = _pNodeIndex->Find(inData);
 
-    RetrieveLeftBoundaryNodesOfBinaryTreeNode(_pRootNode->GetLeftNode(),
-                                              vNodes);
+        if (nullptr == pEntry)
+        {
+            return nullptr;
+        }
 
-    RetrieveLeafNodesOfBinaryTreeNode(_pRootNode,
-                                      vNodes);
+        pNode = pEntry->pNode;
 
-    RetrieveRightBoundaryNodesOfBinaryTreeNode(_pRootNode->GetRightNode(),
-                                               vNodes);
+        ovPath.resize(pEntry->nDepth);
 
-    std::cout << "Boundary nodes: ";
+        for (int nIdx = pEntry->nDepth - 1; (0 <= nIdx) && (nullptr != pEntry); --nIdx)
+        {
+            ovPath[nIdx] = pEntry->pParentNode;
 
-    for (auto pNode : vNodes)
+            pEntry = _pNodeIndex->Find(ovPath[nIdx]->GetData(), ovPath[nIdx]);
+        }
+
+        return pNode;
+    }
+
+    if (_bOrderedTree)
     {
-        if (nullptr != pNode)
+        while ((nullptr != pNode) && (pNode->GetData() != inData))
         {
-            std::cout << pNode->GetData() << " ";
+            ovPath.push_back(pNode);
+
+            pNode = (inData < pNode->GetData()) ? pNode->GetLeftNode() : pNode->GetRightNode();
+        }
+
+        if (nullptr == pNode)
+        {
+            ovPath.clear();
         }
+
+        return pNode;
     }
 
-    std::cout << std::endl;
-}
+    /**
+     * Depth-first search, left before right. The path holds the
+     * ancestors of the current node, each with the number of its
+     * children which are visited already.
+     */
+    std::vector<int> vVisitedChildren;
 
-//-------------------------------------------------------------------
-void BinaryTree::PrintAllFullNodes()
-{
-    std::vector<Node *> vNodes;
+    while (nullptr != pNode)
+    {
+        if (pNode->GetData() == inData)
+        {
+            break;
+        }
 
-    PrintFullNodes(_pRootNode,
-                   vNodes);
+        ovPath.push_back(pNode);
+        vVisitedChildren.push_back(0);
 
-    std::cout << "Full nodes: ";
+        pNode = nullptr;
 
-    for (auto pNode : vNodes)
-    {
-        if (nullptr != pNode)
+        while ((nullptr == pNode) && (!ovPath.empty()))
         {
-            std::cout << pNode->GetData() << " ";
+            int &nVisitedChildren = vVisitedChildren.back();
+
+            if (0 == nVisitedChildren)
+            {
+                pNode = ovPath.back()->GetLeftNode();
+            }
+            else if (1 == nVisitedChildren)
+            {
+                pNode = ovPath.back()->GetRightNode();
+            }
+            else
+            {
+                ovPath.pop_back();
+                vVisitedChildren.pop_back();
+                continue;
+            }
+
+            ++nVisitedChildren;
         }
     }
 
-    std::cout << std::endl;
+    return pNode;
 }
 
 //-------------------------------------------------------------------
-void BinaryTree::PrintAllHalfNodes()
+Node *BinaryTree::DescendBinarySearchTree(int inData,
+                                          Node *&opParentNode,
+                                          int &onDepth)
 {
-    std::vector<Node *> vNodes;
+    Node *pParentNode = nullptr;
+    int nDepth(0);
 
-    PrintHalfNodes(_pRootNode,
-                   vNodes);
+    if (!_bBranchlessSearch)
+    {
+        Node *pNode = _pRootNode;
 
-    std::cout << "Half nodes: ";
+        while ((nullptr != pNode) && (pNode->GetData() != inData))
+        {
+            pParentNode = pNode;
+            ++nDepth;
+
+            pNode = (inData < pNode->GetData()) ? pNode->GetLeftNode() : pNode->GetRightNode();
+        }
 
-    for (auto pNode : vNodes)
-    {
         if (nullptr != pNode)
         {
-            std::cout << pNode->GetData() << " ";
+            opParentNode = pParentNode;
+            onDepth = nDepth;
         }
+
+        return pNode;
     }
 
-    std::cout << std::endl;
-}
+    /**
+     * Lower bound descent. The last node not smaller than the data
+     * holds the data if any node does. The selections compile to
+     * conditional moves and the child to an indexed load.
+     */
+    Node *pCandidateNode = nullptr;
+    Node *pCandidateParentNode = nullptr;
+    int nCandidateDepth(0);
 
-//-------------------------------------------------------------------
-void BinaryTree::PrintAllNodesAtKDistance(int inKDistance)
-{
-    std::vector<Node *> vNodes;
+    for (Node *pNode = _pRootNode; nullptr != pNode; ++nDepth)
+    {
+        bool bRight = (pNode->GetData() < inData);
 
-    RetrieveAllNodesAtKDistance(_pRootNode,
-                                inKDistance,
-                                vNodes);
+        pCandidateNode = bRight ? pCandidateNode : pNode;
+        pCandidateParentNode = bRight ? pCandidateParentNode : pParentNode;
+        nCandidateDepth = bRight ? nCandidateDepth : nDepth;
 
-    std::cout << "All nodes at 'k' distance: ";
+        pParentNode = pNode;
+        pNode = pNode->GetChildNode(bRight);
+    }
 
-    for (auto pNode : vNodes)
+    if ((nullptr == pCandidateNode) || (pCandidateNode->GetData() != inData))
     {
-        if (nullptr != pNode)
-        {
-            std::cout << pNode->GetData() << " ";
-        }
+        return nullptr;
     }
 
-    std::cout << std::endl;
+    opParentNode = pCandidateParentNode;
+    onDepth = nCandidateDepth;
+
+    return pCandidateNode;
 }
 
 //-------------------------------------------------------------------
-void BinaryTree::PrintSibling(int inData)
+void BinaryTree::NotifyNodeInserted(Node *ipNode)
 {
-    Node *pNode = RetrieveSibling(_pRootNode, inData);
+    if (nullptr != _pBloomFilter)
+    {
+        /**
+         * Resize the filter once it holds twice the data it is
+         * sized for, before its false-positive rate degrades
+         */
+        if (_nNodeCount > (2 * _pBloomFilter->Capacity()))
+        {
+            _pBloomFilter->Reset(2 * _nNodeCount);
+            RebuildBloomFilter();
+        }
+        else
+        {
+            _pBloomFilter->Insert(ipNode->GetData());
+        }
+    }
 
-    if (nullptr != pNode)
+    const int nData = ipNode->GetData();
+
+    if (nullptr != _pRadixIndex)
     {
-        std::cout << "Sibling of " << inData << ": " << pNode->GetData();
+        _pRadixIndex->Insert(nData, ipNode);
     }
-    else
+
+    if ((1 == _nNodeCount) || (_bDenseKeysStale))
     {
-        std::cout << "No sibling present for the given data." << std::endl;
+        RebuildDenseKeyBitmap();
+        return;
     }
 
-    std::cout << std::endl;
+    _nMinData = std::min(_nMinData, nData);
+    _nMaxData = std::max(_nMaxData, nData);
+
+    if ((nullptr != _pDenseKeyBitmap) && (_pDenseKeyBitmap->Covers(nData)))
+    {
+        _pDenseKeyBitmap->Set(nData);
+    }
+    else if ((nullptr != _pDenseKeyBitmap) ||
+             ((((long long)(_nMaxData) - _nMinData) + 1) <= (64LL * _nNodeCount)))
+    {
+        RebuildDenseKeyBitmap();
+    }
 }
 
 //-------------------------------------------------------------------
-void BinaryTree::PrintCousins(int inData)
+void BinaryTree::NotifyDataRemoved(int inData,
+                                   const Node *ipNode)
 {
-    std::vector<Node *> vNodes;
-
-    RetrieveCousins(_pRootNode,
-                    inData,
-                    vNodes);
-
-    std::cout << "Cousins of " << inData << ": ";
-
-    for (auto pNode : vNodes)
+    /**
+     * Removing the smallest or the largest data shrinks the range,
+     * otherwise a single outlier would keep the bitmap off for good
+     */
+    if ((0 != _nNodeCount) && ((inData == _nMinData) || (inData == _nMaxData)))
     {
-        if (nullptr != pNode)
+        if (_bOrderedTree)
         {
-            std::cout << pNode->GetData() << " ";
+            UpdateDataRange();
+        }
+        else
+        {
+            _bDenseKeysStale = true;
         }
     }
 
-    std::cout << std::endl;
-}
+    /**
+     * Twice the density needed to build the bitmap is needed to drop
+     * it, so that a tree at the threshold does not keep rebuilding
+     */
+    if ((nullptr != _pDenseKeyBitmap) &&
+        ((0 == _nNodeCount) || ((((long long)(_nMaxData) - _nMinData) + 1) > (128LL * _nNodeCount))))
+    {
+        delete _pDenseKeyBitmap;
+        _pDenseKeyBitmap = nullptr;
+    }
 
-//-------------------------------------------------------------------
-void BinaryTree::PrintAncestors(int inData)
-{
-    if (IsEmpty())
+    if ((nullptr == _pDenseKeyBitmap) && (nullptr == _pRadixIndex))
     {
         return;
     }
 
-    std::deque<Node *> dqNodes;
+    std::vector<Node *> vPath;
 
-    Node *pNode = SearchInBinaryTree(_pRootNode,
-                                     inData,
-                                     dqNodes);
+    Node *pOtherNode = SearchInBinaryTree(_pRootNode, inData, vPath);
 
-    if (nullptr != pNode)
+    if (nullptr == pOtherNode)
     {
-        std::cout << "Ancestors of " << inData << ": ";
+        /**
+         * A stale bitmap may not cover data linked in since it was built
+         */
+        if ((nullptr != _pDenseKeyBitmap) && (_pDenseKeyBitmap->Covers(inData)))
+        {
+            _pDenseKeyBitmap->Clear(inData);
+        }
 
-        for (auto pNode : dqNodes)
+        if (nullptr != _pRadixIndex)
         {
-            if (nullptr != pNode)
-            {
-                std::cout << pNode->GetData() << " ";
-            }
+            _pRadixIndex->Remove(inData);
         }
     }
-    else
+    else if ((nullptr != _pRadixIndex) && (ipNode == _pRadixIndex->Find(inData)))
     {
-        std::cout << "Node is not found for the given data." << std::endl;
+        _pRadixIndex->Replace(inData, pOtherNode);
     }
-
-    std::cout << std::endl;
 }
 
 //-------------------------------------------------------------------
-void BinaryTree::PrintDecendants(int inData)
+void BinaryTree::RebuildDenseKeyBitmap()
 {
-    std::deque<Node *> dqNodes;
-
-    Node *pNode = SearchInBinaryTree(_pRootNode,
-                                     inData,
-                                     dqNodes);
-
-    std::vector<Node *> vNodes;
-
-    PreOrderTraversalOfBinaryTreeNode(pNode,
-                                      vNodes);
+    delete _pDenseKeyBitmap;
+    _pDenseKeyBitmap = nullptr;
 
-    std::cout << "Decendants of " << inData << ": ";
+    _bDenseKeysStale = false;
 
-    for (auto pNode : vNodes)
+    if (nullptr == _pRootNode)
     {
-        if (nullptr != pNode)
-        {
-            std::cout << pNode->GetData() << " ";
-        }
+        return;
     }
 
-    std::cout << std::endl;
-}
-
-//-------------------------------------------------------------------
-void BinaryTree::PrintAncestor(int inData)
-{
-    std::deque<Node *> dqNodes;
+    std::vector<Node *> vNodes;
 
-    if (nullptr != SearchInBinaryTree(_pRootNode, inData, dqNodes))
+    /**
+     * A binary search tree reads its range off its outermost paths,
+     * so a sparse range is told apart without visiting every node
+     */
+    if (_bOrderedTree)
     {
-        Node *pNode = dqNodes.back();
-
-        if (nullptr != pNode)
-        {
-            std::cout << "Ancestor of " << inData << ": " << pNode->GetData();
-        }
+        UpdateDataRange();
     }
     else
     {
-        std::cout << "Node is not found for the given data." << std::endl;
-    }
+        LevelOrderTraversalOfBinaryTreeNode(_pRootNode, vNodes);
 
-    std::cout << std::endl;
-}
+        _nMinData = vNodes.front()->GetData();
+        _nMaxData = _nMinData;
 
-//-------------------------------------------------------------------
-int BinaryTree::HeightOfBinaryTree()
-{
-    return HeightOfSubBinaryTree(_pRootNode);
-}
+        for (auto pNode : vNodes)
+        {
+            _nMinData = std::min(_nMinData, pNode->GetData());
+            _nMaxData = std::max(_nMaxData, pNode->GetData());
+        }
+    }
 
-//-------------------------------------------------------------------
-int BinaryTree::FindLevelOfNode(int inData)
-{
-    int nLevel(-1);
+    long long nRange = ((long long)(_nMaxData) - _nMinData) + 1;
 
-    std::deque<Node *> dqNodes;
+    if (nRange > (64LL * _nNodeCount))
+    {
+        return;
+    }
 
-    if (SearchInBinaryTree(_pRootNode, inData, dqNodes))
+    if (vNodes.empty())
     {
-        nLevel = dqNodes.size();
+        LevelOrderTraversalOfBinaryTreeNode(_pRootNode, vNodes);
     }
 
-    return nLevel;
-}
+    long long nSlack = nRange / 4;
 
-//===================================================================
-// Private Methods: Implementation
-//===================================================================
+    _pDenseKeyBitmap = new DenseKeyBitmap((int)(std::max<long long>(INT_MIN, _nMinData - nSlack)),
+                                          (int)(std::min<long long>(INT_MAX, _nMaxData + nSlack)));
 
-//-------------------------------------------------------------------
-BinaryTree::BinaryTree() : _pRootNode(nullptr)
-{
+    for (auto pNode : vNodes)
+    {
+        _pDenseKeyBitmap->Set(pNode->GetData());
+    }
 }
 
 //-------------------------------------------------------------------
-BinaryTree::~BinaryTree()
+void BinaryTree::UpdateDataRange()
 {
-}
+    Node *pMinNode = _pRootNode;
 
-//-------------------------------------------------------------------
-void BinaryTree::RemoveChildren(Node *ipParentNode)
-{
-    if (nullptr != ipParentNode)
+    while (nullptr != pMinNode->GetLeftNode())
     {
-        Node *pLNode = ipParentNode->GetLeftNode();
-        Node *pRNode = ipParentNode->GetRightNode();
-
-        std::thread objThread1(&BinaryTree::RemoveChildren, this, pLNode);
-        std::thread objThread2(&BinaryTree::RemoveChildren, this, pRNode);
-
-        objThread1.join();
-        objThread2.join();
+        pMinNode = pMinNode->GetLeftNode();
+    }
 
-        delete pLNode;
-        delete pRNode;
+    Node *pMaxNode = _pRootNode;
 
-        pLNode = nullptr;
-        pRNode = nullptr;
+    while (nullptr != pMaxNode->GetRightNode())
+    {
+        pMaxNode = pMaxNode->GetRightNode();
     }
+
+    _nMinData = pMinNode->GetData();
+    _nMaxData = pMaxNode->GetData();
 }
 
 //-------------------------------------------------------------------
-Node *BinaryTree::SearchInBinaryTree(Node *ipNode,
-                                     int inData,
-                                     std::deque<Node *> &iodqNodes)
+Node *BinaryTree::LocateNode(int inData,
+                             Node *&opParentNode,
+                             int &onDepth)
 {
-    Node *pNode = nullptr;
+    opParentNode = nullptr;
+    onDepth = 0;
 
-    if (nullptr != ipNode)
+    if ((nullptr != _pDenseKeyBitmap) && (!_bDenseKeysStale) && (!_pDenseKeyBitmap->Test(inData)))
+    {
+        return nullptr;
+    }
+
+    if ((nullptr != _pBloomFilter) && (!_pBloomFilter->MayContain(inData)))
+    {
+        return nullptr;
+    }
+
+    /**
+     * The radix index knows no parent node nor depth, it only spares
+     * the walk for an absent data
+     */
+    if ((nullptr != _pRadixIndex) && (nullptr == _pRadixIndex->Find(inData)))
+    {
+        return nullptr;
+    }
+
+    if (nullptr != _pNodeIndex)
     {
-        if (ipNode->GetData() == inData)
+        NodeIndex::Entry *pEntry = _pNodeIndex->Find(inData);
+
+        if (nullptr == pEntry)
         {
-            pNode = ipNode;
+            return nullptr;
         }
-        else
-        {
-            pNode = SearchInBinaryTree(ipNode->GetLeftNode(), inData, iodqNodes);
 
-            if (nullptr == pNode)
-            {
-                pNode = SearchInBinaryTree(ipNode->GetRightNode(), inData, iodqNodes);
-            }
+        opParentNode = pEntry->pParentNode;
+        onDepth = pEntry->nDepth;
 
-            if (nullptr != pNode)
-            {
-                iodqNodes.push_front(ipNode);
-            }
-        }
+        return pEntry->pNode;
+    }
+
+    if (_bOrderedTree)
+    {
+        return DescendBinarySearchTree(inData, opParentNode, onDepth);
+    }
+
+    std::vector<Node *> vPath;
+
+    Node *pNode = SearchInBinaryTree(_pRootNode, inData, vPath);
+
+    if (!vPath.empty())
+    {
+        opParentNode = vPath.back();
+        onDepth = (int)(vPath.size());
     }
 
     return pNode;
@@ -1048,98 +4801,419 @@ void BinaryTree::RetrieveAllNodesAtKDistance(Node *ipNode,
 }
 
 //-------------------------------------------------------------------
-Node *BinaryTree::RetrieveSibling(Node *ipNode,
-                                  int inData)
+int BinaryTree::RankOfData(int inData,
+                           bool ibInclusive)
 {
-    Node *pNode = nullptr;
+    int nRank(0);
 
-    if (nullptr != ipNode)
+    Node *pNode = _pRootNode;
+
+    while (nullptr != pNode)
     {
-        Node *pLNode = ipNode->GetLeftNode();
-        Node *pRNode = ipNode->GetRightNode();
+        if ((pNode->GetData() < inData) || (ibInclusive && (pNode->GetData() == inData)))
+        {
+            nRank += RetrieveSubtreeSize(pNode->GetLeftNode()) + pNode->GetCount();
+            pNode = pNode->GetRightNode();
+        }
+        else
+        {
+            pNode = pNode->GetLeftNode();
+        }
+    }
+
+    return nRank;
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::RetrieveRangeNodes(int inLowData,
+                                    int inHighData,
+                                    std::vector<Node *> &ovNodes)
+{
+    ovNodes.clear();
+
+    if (inLowData > inHighData)
+    {
+        return;
+    }
+
+    std::vector<Node *> vStack;
+
+    if (!_bOrderedTree)
+    {
+        if (nullptr != _pRootNode)
+        {
+            vStack.push_back(_pRootNode);
+        }
+
+        while (!vStack.empty())
+        {
+            Node *pNode = vStack.back();
+
+            vStack.pop_back();
+
+            if ((inLowData <= pNode->GetData()) && (pNode->GetData() <= inHighData))
+            {
+                ovNodes.push_back(pNode);
+            }
+
+            for (Node *pChildNode : {pNode->GetLeftNode(), pNode->GetRightNode()})
+            {
+                if (nullptr != pChildNode)
+                {
+                    vStack.push_back(pChildNode);
+                }
+            }
+        }
+
+        std::sort(ovNodes.begin(), ovNodes.end(), [](const Node *ipFirstNode, const Node *ipSecondNode)
+                  { return ipFirstNode->GetData() < ipSecondNode->GetData(); });
+        return;
+    }
+
+    /**
+     * In-order walk which steps over a node below the interval along
+     * with its left sub-binary tree, and stops at the first node above
+     * the interval since all following nodes are larger
+     */
+    Node *pNode = _pRootNode;
+
+    while ((nullptr != pNode) || (!vStack.empty()))
+    {
+        while (nullptr != pNode)
+        {
+            if (pNode->GetData() < inLowData)
+            {
+                pNode = pNode->GetRightNode();
+            }
+            else
+            {
+                vStack.push_back(pNode);
+                pNode = pNode->GetLeftNode();
+            }
+        }
 
-        if ((nullptr != pLNode) && (pLNode->GetData() == inData))
+        if (vStack.empty())
         {
-            pNode = pRNode;
+            break;
         }
-        else if ((nullptr != pRNode) && (pRNode->GetData() == inData))
+
+        pNode = vStack.back();
+
+        vStack.pop_back();
+
+        if (pNode->GetData() > inHighData)
         {
-            pNode = pLNode;
+            break;
         }
 
-        if (nullptr == pNode)
+        ovNodes.push_back(pNode);
+
+        pNode = pNode->GetRightNode();
+    }
+}
+
+//-------------------------------------------------------------------
+bool BinaryTree::RetrieveNeighbourData(int inData,
+                                       bool ibLarger,
+                                       bool ibInclusive,
+                                       int &onData)
+{
+    /**
+     * A data on the wanted side of the given data, or equal to it if
+     * inclusive
+     */
+    auto fnIsCandidate = [inData, ibLarger, ibInclusive](int inNodeData)
+    {
+        return (ibInclusive && (inNodeData == inData)) || (ibLarger ? (inNodeData > inData) : (inNodeData < inData));
+    };
+
+    Node *pNeighbourNode = nullptr;
+
+    if (_bOrderedTree)
+    {
+        /**
+         * Every candidate passed is closer than the previous one, as
+         * the descent then turns towards the given data
+         */
+        Node *pNode = _pRootNode;
+
+        while (nullptr != pNode)
         {
-            pNode = RetrieveSibling(pLNode, inData);
+            if (fnIsCandidate(pNode->GetData()))
+            {
+                pNeighbourNode = pNode;
+
+                if (pNode->GetData() == inData)
+                {
+                    break;
+                }
+
+                pNode = pNode->GetChildNode(!ibLarger);
+            }
+            else
+            {
+                pNode = pNode->GetChildNode(ibLarger);
+            }
+        }
+    }
+    else if (nullptr != _pRootNode)
+    {
+        std::vector<Node *> vNodes;
+
+        LevelOrderTraversalOfBinaryTreeNode(_pRootNode, vNodes);
 
-            if (nullptr == pNode)
+        for (auto pNode : vNodes)
+        {
+            if (fnIsCandidate(pNode->GetData()) &&
+                ((nullptr == pNeighbourNode) || ((pNode->GetData() < pNeighbourNode->GetData()) == ibLarger)))
             {
-                pNode = RetrieveSibling(pRNode, inData);
+                pNeighbourNode = pNode;
             }
         }
     }
 
-    return pNode;
+    if (nullptr == pNeighbourNode)
+    {
+        return false;
+    }
+
+    onData = pNeighbourNode->GetData();
+
+    return true;
 }
 
 //-------------------------------------------------------------------
-void BinaryTree::RetrieveCousins(Node *ipRootNode,
-                                 int inData,
-                                 std::vector<Node *> &ovNodes)
+int BinaryTree::RetrieveSubtreeSize(const Node *ipNode)
 {
-    if (nullptr == ipRootNode)
+    return (nullptr != ipNode) ? static_cast<const AugmentedNode *>(ipNode)->GetSize() : 0;
+}
+
+//-------------------------------------------------------------------
+int BinaryTree::RetrieveSubtreeHeight(const Node *ipNode)
+{
+    return (nullptr != ipNode) ? static_cast<const AugmentedNode *>(ipNode)->GetHeight() : -1;
+}
+
+//-------------------------------------------------------------------
+bool BinaryTree::IsAugmented() const
+{
+    return _bSubtreeSizes || _bRangeAggregates || _bSubtreeHeights;
+}
+
+//-------------------------------------------------------------------
+Node *BinaryTree::CreateNode(int inData)
+{
+    if (_bRangeAggregates)
     {
-        return;
+        return new AggregateNode(inData);
     }
 
-    bool bFound(false);
+    if (_bAugmentedNodes)
+    {
+        return new AugmentedNode(inData);
+    }
 
-    Node *pNode = nullptr;
-    Node *pLNode = nullptr;
-    Node *pRNode = nullptr;
+    return new Node(inData);
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::AugmentNodes()
+{
+    /**
+     * Every node is copied into an AugmentedNode linked under the
+     * copy of its parent, then the old node is freed
+     */
+    struct NodeCopy
+    {
+        Node *pNode;
+        Node *pParentNode;
+        bool bRight;
+    };
 
-    std::queue<Node *> qCurrLevelNodes;
-    std::queue<Node *> qNextLevelNodes;
+    std::stack<NodeCopy> stNodes;
 
-    qCurrLevelNodes.push(ipRootNode);
+    if (nullptr != _pRootNode)
+    {
+        stNodes.push({_pRootNode, nullptr, false});
+    }
 
-    while (!qCurrLevelNodes.empty())
+    while (!stNodes.empty())
     {
-        pNode = qCurrLevelNodes.front();
+        const NodeCopy objNodeCopy = stNodes.top();
+        stNodes.pop();
 
-        qCurrLevelNodes.pop();
+        Node *pNewNode = new AugmentedNode(objNodeCopy.pNode->GetData());
+        pNewNode->SetCount(objNodeCopy.pNode->GetCount());
+        pNewNode->SetRed(objNodeCopy.pNode->IsRed());
 
-        if (nullptr != pNode)
+        if (nullptr == objNodeCopy.pParentNode)
         {
-            pLNode = pNode->GetLeftNode();
-            pRNode = pNode->GetRightNode();
+            _pRootNode = pNewNode;
+        }
+        else
+        {
+            objNodeCopy.pParentNode->SetChildNode(objNodeCopy.bRight, pNewNode);
+        }
 
-            if (((nullptr != pLNode) && (pLNode->GetData() == inData)) ||
-                ((nullptr != pRNode) && (pRNode->GetData() == inData)))
-            {
-                bFound = true;
-            }
-            else
-            {
-                qNextLevelNodes.push(pLNode);
-                qNextLevelNodes.push(pRNode);
-            }
+        if (nullptr != objNodeCopy.pNode->GetLeftNode())
+        {
+            stNodes.push({objNodeCopy.pNode->GetLeftNode(), pNewNode, false});
         }
 
-        if ((qCurrLevelNodes.empty()) && (!bFound))
+        if (nullptr != objNodeCopy.pNode->GetRightNode())
         {
-            std::swap(qCurrLevelNodes, qNextLevelNodes);
+            stNodes.push({objNodeCopy.pNode->GetRightNode(), pNewNode, true});
         }
+
+        delete objNodeCopy.pNode;
+    }
+
+    _bAugmentedNodes = true;
+
+    /**
+     * Whatever pointed at the old nodes is rebuilt over the new ones
+     */
+    ClearFingerPath();
+
+    if (nullptr != _pNodeIndex)
+    {
+        EnableNodeIndex();
+    }
+
+    if (nullptr != _pRadixIndex)
+    {
+        EnableRadixIndex();
+    }
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::UpdateAugmentation(Node *ipNode)
+{
+    if (_bSubtreeSizes)
+    {
+        static_cast<AugmentedNode *>(ipNode)->SetSize(ipNode->GetCount() + RetrieveSubtreeSize(ipNode->GetLeftNode()) + RetrieveSubtreeSize(ipNode->GetRightNode()));
+    }
+
+    if (_bRangeAggregates)
+    {
+        static_cast<AggregateNode *>(ipNode)->UpdateSummary();
+    }
+
+    if (_bSubtreeHeights)
+    {
+        static_cast<AugmentedNode *>(ipNode)->SetHeight(1 + std::max(RetrieveSubtreeHeight(ipNode->GetLeftNode()), RetrieveSubtreeHeight(ipNode->GetRightNode())));
+    }
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::UpdateAugmentations(const std::vector<Node *> &ivNodes)
+{
+    if (!IsAugmented())
+    {
+        return;
+    }
+
+    for (auto itNode = ivNodes.rbegin(); itNode != ivNodes.rend(); ++itNode)
+    {
+        UpdateAugmentation(*itNode);
+    }
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::UpdateFingerPathAugmentations()
+{
+    if (!IsAugmented())
+    {
+        return;
+    }
+
+    for (auto itNode = _vFingerPath.rbegin(); itNode != _vFingerPath.rend(); ++itNode)
+    {
+        UpdateAugmentation(*itNode);
+    }
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::DescendFingerPath(Node *ipChildNode)
+{
+    FingerRange objRange = _vFingerRanges.back();
+
+    if (_vFingerPath.back()->GetRightNode() == ipChildNode)
+    {
+        objRange.nLowerBound = _vFingerPath.back()->GetData();
+    }
+    else
+    {
+        objRange.nUpperBound = _vFingerPath.back()->GetData();
     }
 
-    while (!qNextLevelNodes.empty())
+    _vFingerPath.push_back(ipChildNode);
+    _vFingerRanges.push_back(objRange);
+}
+
+//-------------------------------------------------------------------
+void BinaryTree::ClearFingerPath()
+{
+    _vFingerPath.clear();
+    _vFingerRanges.clear();
+}
+
+//-------------------------------------------------------------------
+int BinaryTree::CountNodesOfSubBinaryTree(Node *ipNode)
+{
+    int nCount(0);
+
+    if (nullptr != ipNode)
     {
-        pNode = qNextLevelNodes.front();
+        nCount = 1 + CountNodesOfSubBinaryTree(ipNode->GetLeftNode()) + CountNodesOfSubBinaryTree(ipNode->GetRightNode());
+    }
+
+    return nCount;
+}
+
+//-------------------------------------------------------------------
+int BinaryTree::CountNodesOfFirstSubBinaryTree(Node *ipFirstNode,
+                                               Node *ipSecondNode,
+                                               int inNodeCount)
+{
+    /**
+     * Both sub-binary trees are walked one node each in turn, and the
+     * smaller one finishes first
+     */
+    std::vector<Node *> avStacks[2];
+    int anCounts[2] = {0, 0};
 
-        qNextLevelNodes.pop();
+    for (int nSide = 0; nSide < 2; ++nSide)
+    {
+        Node *pNode = (0 == nSide) ? ipFirstNode : ipSecondNode;
 
         if (nullptr != pNode)
         {
-            ovNodes.push_back(pNode);
+            avStacks[nSide].push_back(pNode);
+        }
+    }
+
+    while (true)
+    {
+        for (int nSide = 0; nSide < 2; ++nSide)
+        {
+            if (avStacks[nSide].empty())
+            {
+                return (0 == nSide) ? anCounts[0] : (inNodeCount - anCounts[1]);
+            }
+
+            Node *pNode = avStacks[nSide].back();
+
+            avStacks[nSide].pop_back();
+            ++anCounts[nSide];
+
+            for (Node *pChildNode : {pNode->GetLeftNode(), pNode->GetRightNode()})
+            {
+                if (nullptr != pChildNode)
+                {
+                    avStacks[nSide].push_back(pChildNode);
+                }
+            }
         }
     }
 }
@@ -1147,6 +5221,11 @@ void BinaryTree::RetrieveCousins(Node *ipRootNode,
 //-------------------------------------------------------------------
 int BinaryTree::HeightOfSubBinaryTree(Node *ipNode)
 {
+    if (_bSubtreeHeights)
+    {
+        return RetrieveSubtreeHeight(ipNode);
+    }
+
     int nHeight(-1);
 
     if (nullptr != ipNode)
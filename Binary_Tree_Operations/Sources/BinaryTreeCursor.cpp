@@ -0,0 +1,182 @@
+//-------------------------------------------------------------------
+/**
+ * @file BinaryTreeCursor.cpp
+ * @brief Implementation file for the BinaryTreeCursor class.
+ * @author Aditya Jedhe
+ * @date 2025-03-20
+ */
+//-------------------------------------------------------------------
+
+// ---------------------------------------------- Local Headers
+#include "BinaryTree.h"
+#include "BinaryTreeCursor.h"
+
+// ---------------------------------------------- Project Headers
+#include "Node.h"
+
+// ---------------------------------------------- System Headers
+#include <iostream>
+
+//-------------------------------------------------------------------
+BinaryTreeCursor::BinaryTreeCursor(BinaryTree *ipBinaryTree) : _pBinaryTree(ipBinaryTree)
+{
+}
+
+//-------------------------------------------------------------------
+BinaryTreeCursor::~BinaryTreeCursor()
+{
+}
+
+//-------------------------------------------------------------------
+bool BinaryTreeCursor::First()
+{
+    _vPath.clear();
+
+    if (!IsOrderedTree())
+    {
+        return false;
+    }
+
+    DescendToExtreme(_pBinaryTree->_pRootNode, false);
+
+    return IsValid();
+}
+
+//-------------------------------------------------------------------
+bool BinaryTreeCursor::Last()
+{
+    _vPath.clear();
+
+    if (!IsOrderedTree())
+    {
+        return false;
+    }
+
+    DescendToExtreme(_pBinaryTree->_pRootNode, true);
+
+    return IsValid();
+}
+
+//-------------------------------------------------------------------
+bool BinaryTreeCursor::Seek(int inData)
+{
+    _vPath.clear();
+
+    if (!IsOrderedTree())
+    {
+        return false;
+    }
+
+    /**
+     * The path is kept up to the last node passed which is not less
+     * than the data, the nodes below it are dropped afterwards
+     */
+    int nLength(0);
+
+    for (Node *pNode = _pBinaryTree->_pRootNode; nullptr != pNode;)
+    {
+        _vPath.push_back(pNode);
+
+        if (pNode->GetData() >= inData)
+        {
+            nLength = (int)(_vPath.size());
+
+            if (pNode->GetData() == inData)
+            {
+                break;
+            }
+
+            pNode = pNode->GetLeftNode();
+        }
+        else
+        {
+            pNode = pNode->GetRightNode();
+        }
+    }
+
+    _vPath.resize(nLength);
+
+    return IsValid();
+}
+
+//-------------------------------------------------------------------
+bool BinaryTreeCursor::Next()
+{
+    return Step(true);
+}
+
+//-------------------------------------------------------------------
+bool BinaryTreeCursor::Previous()
+{
+    return Step(false);
+}
+
+//-------------------------------------------------------------------
+bool BinaryTreeCursor::IsValid() const
+{
+    return !_vPath.empty();
+}
+
+//-------------------------------------------------------------------
+int BinaryTreeCursor::GetData() const
+{
+    return _vPath.back()->GetData();
+}
+
+//-------------------------------------------------------------------
+int BinaryTreeCursor::GetCount() const
+{
+    return _vPath.back()->GetCount();
+}
+
+//-------------------------------------------------------------------
+bool BinaryTreeCursor::IsOrderedTree() const
+{
+    if ((nullptr == _pBinaryTree) || (!_pBinaryTree->_bOrderedTree))
+    {
+        std::cout << "ERR<<Cursor needs a binary search tree.>>" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+//-------------------------------------------------------------------
+void BinaryTreeCursor::DescendToExtreme(Node *ipNode,
+                                        bool ibLargest)
+{
+    for (Node *pNode = ipNode; nullptr != pNode; pNode = pNode->GetChildNode(ibLargest))
+    {
+        _vPath.push_back(pNode);
+    }
+}
+
+//-------------------------------------------------------------------
+bool BinaryTreeCursor::Step(bool ibForward)
+{
+    if (_vPath.empty())
+    {
+        return false;
+    }
+
+    /**
+     * The neighbour is the extreme node of the sub-binary tree on the
+     * side of the step, otherwise the first ancestor reached from that
+     * side
+     */
+    Node *pChildNode = _vPath.back()->GetChildNode(ibForward);
+
+    if (nullptr != pChildNode)
+    {
+        DescendToExtreme(pChildNode, !ibForward);
+        return true;
+    }
+
+    do
+    {
+        pChildNode = _vPath.back();
+        _vPath.pop_back();
+    } while ((!_vPath.empty()) && (_vPath.back()->GetChildNode(ibForward) == pChildNode));
+
+    return IsValid();
+}
@@ -0,0 +1,132 @@
+//-------------------------------------------------------------------
+/**
+ * @file BloomFilter.cpp
+ * @brief Implementation file for the BloomFilter class.
+ * @author Aditya Jedhe
+ * @date 2025-03-06
+ */
+//-------------------------------------------------------------------
+
+// ---------------------------------------------- Local Headers
+#include "BloomFilter.h"
+
+// ---------------------------------------------- System Headers
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+//-------------------------------------------------------------------
+BloomFilter::BloomFilter(int inExpectedCount,
+                         double idFalsePositiveRate) : _nCapacity(0),
+                                                       _dFalsePositiveRate(idFalsePositiveRate),
+                                                       _nBitsPerData(1)
+{
+    Reset(inExpectedCount);
+}
+
+//-------------------------------------------------------------------
+BloomFilter::~BloomFilter()
+{
+}
+
+//-------------------------------------------------------------------
+void BloomFilter::Insert(int inData)
+{
+    std::uint64_t nHash = Hash(inData);
+
+    Block &objBlock = _vBlocks[((nHash >> 32) * _vBlocks.size()) >> 32];
+
+    /**
+     * Double hashing picks the bits within the block
+     */
+    nHash = (nHash * 0x9E3779B97F4A7C15ull) ^ (nHash >> 29);
+
+    std::uint32_t nBit = (std::uint32_t)(nHash);
+    std::uint32_t nStep = (std::uint32_t)(nHash >> 32) | 1;
+
+    for (int nIdx = 0; nIdx < _nBitsPerData; ++nIdx, nBit += nStep)
+    {
+        std::atomic_ref<std::uint64_t>(objBlock.aWords[(nBit >> 6) & 7])
+            .fetch_or(1ull << (nBit & 63), std::memory_order_relaxed);
+    }
+}
+
+//-------------------------------------------------------------------
+bool BloomFilter::MayContain(int inData) const
+{
+    std::uint64_t nHash = Hash(inData);
+
+    const Block &objBlock = _vBlocks[((nHash >> 32) * _vBlocks.size()) >> 32];
+
+    nHash = (nHash * 0x9E3779B97F4A7C15ull) ^ (nHash >> 29);
+
+    std::uint32_t nBit = (std::uint32_t)(nHash);
+    std::uint32_t nStep = (std::uint32_t)(nHash >> 32) | 1;
+
+    for (int nIdx = 0; nIdx < _nBitsPerData; ++nIdx, nBit += nStep)
+    {
+        std::uint64_t nWord = std::atomic_ref<std::uint64_t>(const_cast<std::uint64_t &>(objBlock.aWords[(nBit >> 6) & 7]))
+                                  .load(std::memory_order_relaxed);
+
+        if (0 == (nWord & (1ull << (nBit & 63))))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-------------------------------------------------------------------
+void BloomFilter::Reset(int inExpectedCount)
+{
+    _nCapacity = std::max(inExpectedCount, 1);
+
+    /**
+     * Optimal sizing of a Bloom filter: -ln(p) / ln(2)^2 bits
+     * per data and ln(2) times as many bits set per data
+     */
+    const double dLn2 = std::log(2.0);
+    const double dRate = std::clamp(_dFalsePositiveRate, 1e-9, 0.5);
+    const double dBitsPerData = -std::log(dRate) / (dLn2 * dLn2);
+
+    _nBitsPerData = std::clamp((int)(std::lround(dBitsPerData * dLn2)), 1, 16);
+
+    /**
+     * Data hashing to the same block crowd it, which a blocked
+     * filter offsets with a quarter more bits than the optimum
+     */
+    std::size_t nBlocks = (std::size_t)(std::ceil((1.25 * dBitsPerData * _nCapacity) / 512.0));
+
+    _vBlocks.assign(std::max<std::size_t>(nBlocks, 1), Block{});
+}
+
+//-------------------------------------------------------------------
+int BloomFilter::Capacity() const
+{
+    return _nCapacity;
+}
+
+//-------------------------------------------------------------------
+double BloomFilter::FalsePositiveRate() const
+{
+    return _dFalsePositiveRate;
+}
+
+//===================================================================
+// Private Methods: Implementation
+//===================================================================
+
+//-------------------------------------------------------------------
+std::uint64_t BloomFilter::Hash(int inData)
+{
+    /**
+     * SplitMix64 finaliser
+     */
+    std::uint64_t nHash = (std::uint32_t)(inData) + 0x9E3779B97F4A7C15ull;
+
+    nHash = (nHash ^ (nHash >> 30)) * 0xBF58476D1CE4E5B9ull;
+    nHash = (nHash ^ (nHash >> 27)) * 0x94D049BB133111EBull;
+
+    return nHash ^ (nHash >> 31);
+}
@@ -0,0 +1,160 @@
+//-------------------------------------------------------------------
+/**
+ * @file DenseKeyBitmap.cpp
+ * @brief Implementation file for the DenseKeyBitmap class.
+ * @author Aditya Jedhe
+ * @date 2025-03-14
+ */
+//-------------------------------------------------------------------
+
+// ---------------------------------------------- Local Headers
+#include "DenseKeyBitmap.h"
+
+// ---------------------------------------------- System Headers
+#include <atomic>
+#include <bit>
+
+//-------------------------------------------------------------------
+DenseKeyBitmap::DenseKeyBitmap(int inMinData,
+                               int inMaxData) : _nMinData(inMinData),
+                                                _nMaxData(inMaxData)
+{
+    long long nBits = ((long long)(_nMaxData) - _nMinData) + 1;
+    long long nBlocks = (nBits + (64 * _nWordsPerBlock) - 1) / (64 * _nWordsPerBlock);
+
+    _vWords.assign(nBlocks * _nWordsPerBlock, 0);
+    _vBlockCounts.assign(nBlocks + 1, 0);
+}
+
+//-------------------------------------------------------------------
+DenseKeyBitmap::~DenseKeyBitmap()
+{
+}
+
+//-------------------------------------------------------------------
+bool DenseKeyBitmap::Covers(int inData) const
+{
+    return (_nMinData <= inData) && (inData <= _nMaxData);
+}
+
+//-------------------------------------------------------------------
+void DenseKeyBitmap::Set(int inData)
+{
+    std::uint64_t nOffset = OffsetOf(inData);
+    std::uint64_t nBit = 1ull << (nOffset & 63);
+
+    std::uint64_t nWord = std::atomic_ref<std::uint64_t>(_vWords[nOffset >> 6]).fetch_or(nBit, std::memory_order_relaxed);
+
+    if (0 == (nWord & nBit))
+    {
+        AddToBlockCount((int)(nOffset / (64 * _nWordsPerBlock)), 1);
+    }
+}
+
+//-------------------------------------------------------------------
+void DenseKeyBitmap::Clear(int inData)
+{
+    std::uint64_t nOffset = OffsetOf(inData);
+    std::uint64_t nBit = 1ull << (nOffset & 63);
+
+    std::uint64_t nWord = std::atomic_ref<std::uint64_t>(_vWords[nOffset >> 6]).fetch_and(~nBit, std::memory_order_relaxed);
+
+    if (0 != (nWord & nBit))
+    {
+        AddToBlockCount((int)(nOffset / (64 * _nWordsPerBlock)), -1);
+    }
+}
+
+//-------------------------------------------------------------------
+bool DenseKeyBitmap::Test(int inData) const
+{
+    if (!Covers(inData))
+    {
+        return false;
+    }
+
+    std::uint64_t nOffset = OffsetOf(inData);
+
+    /**
+     * A relaxed load costs a plain load and may run alongside Set()
+     */
+    std::uint64_t nWord = std::atomic_ref<std::uint64_t>(const_cast<std::uint64_t &>(_vWords[nOffset >> 6])).load(std::memory_order_relaxed);
+
+    return 0 != ((nWord >> (nOffset & 63)) & 1);
+}
+
+//-------------------------------------------------------------------
+int DenseKeyBitmap::Rank(int inData) const
+{
+    if (inData <= _nMinData)
+    {
+        return 0;
+    }
+
+    if (inData > _nMaxData)
+    {
+        return Count();
+    }
+
+    std::uint64_t nOffset = OffsetOf(inData);
+    int nBlock = (int)(nOffset / (64 * _nWordsPerBlock));
+
+    /**
+     * Set bits of the blocks before, then of the words before
+     * within the block, then of the bits before within the word
+     */
+    int nRank(0);
+
+    for (int nIdx = nBlock; 0 < nIdx; nIdx &= nIdx - 1)
+    {
+        nRank += _vBlockCounts[nIdx];
+    }
+
+    std::size_t nWordIdx = nOffset >> 6;
+
+    for (std::size_t nIdx = (std::size_t)(nBlock) * _nWordsPerBlock; nIdx < nWordIdx; ++nIdx)
+    {
+        nRank += std::popcount(_vWords[nIdx]);
+    }
+
+    nRank += std::popcount(_vWords[nWordIdx] & ((1ull << (nOffset & 63)) - 1));
+
+    return nRank;
+}
+
+//-------------------------------------------------------------------
+int DenseKeyBitmap::Count() const
+{
+    int nCount(0);
+
+    for (int nIdx = (int)(_vBlockCounts.size()) - 1; 0 < nIdx; nIdx &= nIdx - 1)
+    {
+        nCount += _vBlockCounts[nIdx];
+    }
+
+    return nCount;
+}
+
+//===================================================================
+// Private Methods: Implementation
+//===================================================================
+
+//-------------------------------------------------------------------
+std::uint64_t DenseKeyBitmap::OffsetOf(int inData) const
+{
+    /**
+     * The range may span more than INT_MAX, the difference is taken
+     * modulo 2^32 where it cannot overflow
+     */
+    return (std::uint32_t)(inData) - (std::uint32_t)(_nMinData);
+}
+
+//-------------------------------------------------------------------
+void DenseKeyBitmap::AddToBlockCount(int inBlock,
+                                     int inDelta)
+{
+    for (int nIdx = inBlock + 1; nIdx < (int)(_vBlockCounts.size()); nIdx += nIdx & (-nIdx))
+    {
+        std::atomic_ref<int>(_vBlockCounts[nIdx]).fetch_add(inDelta, std::memory_order_relaxed);
+    }
+}
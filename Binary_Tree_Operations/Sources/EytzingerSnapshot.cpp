@@ -0,0 +1,149 @@
+//-------------------------------------------------------------------
+/**
+ * @file EytzingerSnapshot.cpp
+ * @brief Implementation file for the EytzingerSnapshot class.
+ * @author Aditya Jedhe
+ * @date 2025-03-11
+ */
+//-------------------------------------------------------------------
+
+// ---------------------------------------------- Local Headers
+#include "BinaryTree.h"
+#include "EytzingerSnapshot.h"
+
+// ---------------------------------------------- System Headers
+#include <algorithm>
+#include <bit>
+#include <climits>
+#include <cstddef>
+
+//-------------------------------------------------------------------
+EytzingerSnapshot::EytzingerSnapshot(BinaryTree *ipBinaryTree) : _nSize(0)
+{
+    Refresh(ipBinaryTree);
+}
+
+//-------------------------------------------------------------------
+EytzingerSnapshot::~EytzingerSnapshot()
+{
+}
+
+//-------------------------------------------------------------------
+void EytzingerSnapshot::Refresh(BinaryTree *ipBinaryTree)
+{
+    _vSortedData.clear();
+
+    if (nullptr != ipBinaryTree)
+    {
+        ipBinaryTree->RetrieveInOrderData(_vSortedData);
+    }
+
+    if (!std::is_sorted(_vSortedData.begin(), _vSortedData.end()))
+    {
+        std::sort(_vSortedData.begin(), _vSortedData.end());
+    }
+
+    _nSize = (int)(_vSortedData.size());
+
+    /**
+     * Slots 0 to n
+     */
+    _vLines.resize((_nSize / 16) + 1);
+
+    int nNext(0);
+
+    Layout(1, nNext);
+}
+
+//-------------------------------------------------------------------
+bool EytzingerSnapshot::Search(int inData) const
+{
+    int nSlot = DescendToLowerBound(inData);
+
+    return (0 != nSlot) && (_vLines[nSlot / 16].aData[nSlot % 16] == inData);
+}
+
+//-------------------------------------------------------------------
+bool EytzingerSnapshot::LowerBound(int inData,
+                                   int &onData) const
+{
+    int nSlot = DescendToLowerBound(inData);
+
+    if (0 == nSlot)
+    {
+        return false;
+    }
+
+    onData = _vLines[nSlot / 16].aData[nSlot % 16];
+
+    return true;
+}
+
+//-------------------------------------------------------------------
+bool EytzingerSnapshot::UpperBound(int inData,
+                                   int &onData) const
+{
+    /**
+     * The data greater than an integer are those not less than
+     * its successor
+     */
+    if (INT_MAX == inData)
+    {
+        return false;
+    }
+
+    return LowerBound(inData + 1, onData);
+}
+
+//-------------------------------------------------------------------
+int EytzingerSnapshot::Size() const
+{
+    return _nSize;
+}
+
+//===================================================================
+// Private Methods: Implementation
+//===================================================================
+
+//-------------------------------------------------------------------
+void EytzingerSnapshot::Layout(int inSlot,
+                               int &ionNext)
+{
+    if (inSlot > _nSize)
+    {
+        return;
+    }
+
+    Layout(2 * inSlot, ionNext);
+
+    _vLines[inSlot / 16].aData[inSlot % 16] = _vSortedData[ionNext++];
+
+    Layout((2 * inSlot) + 1, ionNext);
+}
+
+//-------------------------------------------------------------------
+int EytzingerSnapshot::DescendToLowerBound(int inData) const
+{
+    const int *pData = _vLines.front().aData;
+
+    /**
+     * Go right while the data of the slot is less, left otherwise.
+     * The slot 16k is the first of the line holding the descendants
+     * of slot k four levels below, so it is prefetched now.
+     */
+    unsigned int nSlot(1);
+
+    while (nSlot <= (unsigned int)(_nSize))
+    {
+        __builtin_prefetch(pData + (16 * (std::size_t)(nSlot)));
+
+        nSlot = (2 * nSlot) + (pData[nSlot] < inData);
+    }
+
+    /**
+     * The lower bound is the last slot where the descent went left,
+     * i.e. the slot left after dropping the trailing right turns
+     * (set bits) and the left turn (cleared bit) before them
+     */
+    return (int)(nSlot >> (std::countr_one(nSlot) + 1));
+}
@@ -0,0 +1,156 @@
+//-------------------------------------------------------------------
+/**
+ * @file ForkJoinPool.cpp
+ * @brief Implementation file for the ForkJoinPool class.
+ * @author Aditya Jedhe
+ * @date 2025-03-22
+ */
+//-------------------------------------------------------------------
+
+// ---------------------------------------------- Local Headers
+#include "ForkJoinPool.h"
+
+// ---------------------------------------------- System Headers
+#include <algorithm>
+
+//-------------------------------------------------------------------
+ForkJoinPool &ForkJoinPool::RetrieveInstance()
+{
+    static ForkJoinPool objInstance((int)(std::max(std::thread::hardware_concurrency(), 1u)) - 1);
+
+    return objInstance;
+}
+
+//-------------------------------------------------------------------
+ForkJoinPool::~ForkJoinPool()
+{
+    {
+        std::lock_guard<std::mutex> objLock(_objMutex);
+
+        _bStopping = true;
+    }
+
+    _objCondition.notify_all();
+
+    for (auto &objWorker : _vWorkers)
+    {
+        objWorker.join();
+    }
+}
+
+//-------------------------------------------------------------------
+void ForkJoinPool::Invoke(const std::function<void()> &ifnFirstTask,
+                          const std::function<void()> &ifnSecondTask)
+{
+    if (_vWorkers.empty())
+    {
+        ifnFirstTask();
+        ifnSecondTask();
+        return;
+    }
+
+    Task objTask{&ifnFirstTask, false};
+
+    {
+        std::lock_guard<std::mutex> objLock(_objMutex);
+
+        _dqTasks.push_back(&objTask);
+    }
+
+    _objCondition.notify_all();
+
+    ifnSecondTask();
+
+    std::unique_lock<std::mutex> objLock(_objMutex);
+
+    /**
+     * A task nobody took yet is taken back and run by the caller
+     */
+    auto itTask = std::find(_dqTasks.rbegin(), _dqTasks.rend(), &objTask);
+
+    if (_dqTasks.rend() != itTask)
+    {
+        _dqTasks.erase(std::next(itTask).base());
+        objLock.unlock();
+
+        ifnFirstTask();
+        return;
+    }
+
+    /**
+     * Otherwise the caller helps with other tasks until the worker
+     * running it is done
+     */
+    while (!objTask.bDone)
+    {
+        if (_dqTasks.empty())
+        {
+            _objCondition.wait(objLock);
+            continue;
+        }
+
+        Task *pTask = _dqTasks.front();
+        _dqTasks.pop_front();
+
+        objLock.unlock();
+        RunTask(pTask);
+        objLock.lock();
+    }
+}
+
+//-------------------------------------------------------------------
+int ForkJoinPool::WorkerCount() const
+{
+    return (int)(_vWorkers.size());
+}
+
+//===================================================================
+// Private Methods: Implementation
+//===================================================================
+
+//-------------------------------------------------------------------
+ForkJoinPool::ForkJoinPool(int inWorkerCount) : _bStopping(false)
+{
+    for (int nIdx = 0; nIdx < inWorkerCount; ++nIdx)
+    {
+        _vWorkers.emplace_back(&ForkJoinPool::RunWorker, this);
+    }
+}
+
+//-------------------------------------------------------------------
+void ForkJoinPool::RunWorker()
+{
+    std::unique_lock<std::mutex> objLock(_objMutex);
+
+    while (true)
+    {
+        _objCondition.wait(objLock, [this]()
+                           { return _bStopping || (!_dqTasks.empty()); });
+
+        if (_dqTasks.empty())
+        {
+            return;
+        }
+
+        Task *pTask = _dqTasks.front();
+        _dqTasks.pop_front();
+
+        objLock.unlock();
+        RunTask(pTask);
+        objLock.lock();
+    }
+}
+
+//-------------------------------------------------------------------
+void ForkJoinPool::RunTask(Task *ipTask)
+{
+    (*ipTask->pfnTask)();
+
+    {
+        std::lock_guard<std::mutex> objLock(_objMutex);
+
+        ipTask->bDone = true;
+    }
+
+    _objCondition.notify_all();
+}
@@ -0,0 +1,218 @@
+//-------------------------------------------------------------------
+/**
+ * @file NodeIndex.cpp
+ * @brief Implementation file for the NodeIndex class.
+ * @author Aditya Jedhe
+ * @date 2025-03-04
+ */
+//-------------------------------------------------------------------
+
+// ---------------------------------------------- Local Headers
+#include "NodeIndex.h"
+
+// ---------------------------------------------- System Headers
+#include <bit>
+#include <utility>
+
+//-------------------------------------------------------------------
+NodeIndex::NodeIndex(int inExpectedCount) : _nSize(0),
+                                            _nBits(0)
+{
+    Reserve(inExpectedCount);
+}
+
+//-------------------------------------------------------------------
+NodeIndex::~NodeIndex()
+{
+}
+
+//-------------------------------------------------------------------
+void NodeIndex::Reserve(int inCount)
+{
+    /**
+     * Keep the table at most half full
+     */
+    int nCapacity(16);
+
+    while (nCapacity < (2 * inCount))
+    {
+        nCapacity *= 2;
+    }
+
+    if (nCapacity > (int)(_vEntries.size()))
+    {
+        Rehash(nCapacity);
+    }
+}
+
+//-------------------------------------------------------------------
+void NodeIndex::Insert(int inData,
+                       Node *ipNode,
+                       Node *ipParentNode,
+                       int inPosition)
+{
+    if (nullptr == ipNode)
+    {
+        return;
+    }
+
+    if ((2 * (_nSize + 1)) > (int)(_vEntries.size()))
+    {
+        Reserve(_nSize + 1);
+    }
+
+    const int nMask = (int)(_vEntries.size()) - 1;
+
+    int nSlot = HomeSlot(inData);
+
+    while (nullptr != _vEntries[nSlot].pNode)
+    {
+        nSlot = (nSlot + 1) & nMask;
+    }
+
+    _vEntries[nSlot] = {inData, (int)(std::bit_width((unsigned int)(inPosition + 1))) - 1, inPosition, ipNode, ipParentNode};
+
+    ++_nSize;
+}
+
+//-------------------------------------------------------------------
+void NodeIndex::Remove(int inData,
+                       const Node *ipNode)
+{
+    Entry *pEntry = Find(inData, ipNode);
+
+    if (nullptr == pEntry)
+    {
+        return;
+    }
+
+    /**
+     * Shift back every following entry of the cluster whose
+     * probe sequence passes the hole, so no tombstone is needed
+     */
+    const int nMask = (int)(_vEntries.size()) - 1;
+
+    int nHole = (int)(pEntry - _vEntries.data());
+    int nSlot = (nHole + 1) & nMask;
+
+    while (nullptr != _vEntries[nSlot].pNode)
+    {
+        int nHome = HomeSlot(_vEntries[nSlot].nData);
+
+        if (((nSlot - nHome) & nMask) >= ((nSlot - nHole) & nMask))
+        {
+            _vEntries[nHole] = _vEntries[nSlot];
+            nHole = nSlot;
+        }
+
+        nSlot = (nSlot + 1) & nMask;
+    }
+
+    _vEntries[nHole] = {0, 0, 0, nullptr, nullptr};
+
+    --_nSize;
+}
+
+//-------------------------------------------------------------------
+NodeIndex::Entry *NodeIndex::Find(int inData)
+{
+    if (0 == _nSize)
+    {
+        return nullptr;
+    }
+
+    const int nMask = (int)(_vEntries.size()) - 1;
+
+    Entry *pFoundEntry = nullptr;
+
+    for (int nSlot = HomeSlot(inData); nullptr != _vEntries[nSlot].pNode; nSlot = (nSlot + 1) & nMask)
+    {
+        Entry &objEntry = _vEntries[nSlot];
+
+        if ((objEntry.nData == inData) &&
+            ((nullptr == pFoundEntry) || (objEntry.nDepth < pFoundEntry->nDepth)))
+        {
+            pFoundEntry = &objEntry;
+        }
+    }
+
+    return pFoundEntry;
+}
+
+//-------------------------------------------------------------------
+NodeIndex::Entry *NodeIndex::Find(int inData,
+                                  const Node *ipNode)
+{
+    if (0 == _nSize)
+    {
+        return nullptr;
+    }
+
+    const int nMask = (int)(_vEntries.size()) - 1;
+
+    for (int nSlot = HomeSlot(inData); nullptr != _vEntries[nSlot].pNode; nSlot = (nSlot + 1) & nMask)
+    {
+        if (ipNode == _vEntries[nSlot].pNode)
+        {
+            return &_vEntries[nSlot];
+        }
+    }
+
+    return nullptr;
+}
+
+//-------------------------------------------------------------------
+void NodeIndex::Clear()
+{
+    for (auto &objEntry : _vEntries)
+    {
+        objEntry = {0, 0, 0, nullptr, nullptr};
+    }
+
+    _nSize = 0;
+}
+
+//-------------------------------------------------------------------
+int NodeIndex::Size() const
+{
+    return _nSize;
+}
+
+//===================================================================
+// Private Methods: Implementation
+//===================================================================
+
+//-------------------------------------------------------------------
+int NodeIndex::HomeSlot(int inData) const
+{
+    /**
+     * Fibonacci hashing, the top bits of the product are
+     * the best mixed ones
+     */
+    return (int)(((unsigned int)(inData) * 2654435769u) >> (32 - _nBits));
+}
+
+//-------------------------------------------------------------------
+void NodeIndex::Rehash(int inCapacity)
+{
+    std::vector<Entry> vEntries(inCapacity, {0, 0, 0, nullptr, nullptr});
+
+    std::swap(_vEntries, vEntries);
+
+    _nBits = 0;
+
+    while ((1 << _nBits) < inCapacity)
+    {
+        ++_nBits;
+    }
+
+    _nSize = 0;
+
+    for (auto &objEntry : vEntries)
+    {
+        if (nullptr != objEntry.pNode)
+        {
+            Insert(objEntry.nData, objEntry.pNode, objEntry.pParentNode, objEntry.nPosition);
+        }
+    }
+}
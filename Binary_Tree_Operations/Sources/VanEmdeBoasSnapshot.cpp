@@ -0,0 +1,257 @@
+//-------------------------------------------------------------------
+/**
+ * @file VanEmdeBoasSnapshot.cpp
+ * @brief Implementation file for the VanEmdeBoasSnapshot class.
+ * @author Aditya Jedhe
+ * @date 2025-03-12
+ */
+//-------------------------------------------------------------------
+
+// ---------------------------------------------- Local Headers
+#include "BinaryTree.h"
+#include "VanEmdeBoasSnapshot.h"
+
+// ---------------------------------------------- Project Headers
+#include "Node.h"
+
+// ---------------------------------------------- System Headers
+#include <algorithm>
+#include <iostream>
+#include <unordered_map>
+#include <utility>
+
+//-------------------------------------------------------------------
+VanEmdeBoasSnapshot::VanEmdeBoasSnapshot(BinaryTree *ipBinaryTree) : _bOrderedTree(true)
+{
+    Refresh(ipBinaryTree);
+}
+
+//-------------------------------------------------------------------
+VanEmdeBoasSnapshot::~VanEmdeBoasSnapshot()
+{
+}
+
+//-------------------------------------------------------------------
+void VanEmdeBoasSnapshot::Refresh(BinaryTree *ipBinaryTree)
+{
+    _vEntries.clear();
+
+    if ((nullptr == ipBinaryTree) || (nullptr == ipBinaryTree->_pRootNode))
+    {
+        return;
+    }
+
+    _bOrderedTree = ipBinaryTree->_bOrderedTree;
+
+    /**
+     * Number of levels, from an iterative depth-first walk so a
+     * degenerate tree does not exhaust the stack
+     */
+    int nLevels(0);
+
+    std::vector<std::pair<Node *, int>> vStack(1, {ipBinaryTree->_pRootNode, 1});
+
+    while (!vStack.empty())
+    {
+        auto [pNode, nLevel] = vStack.back();
+
+        vStack.pop_back();
+
+        nLevels = std::max(nLevels, nLevel);
+
+        for (Node *pChildNode : {pNode->GetLeftNode(), pNode->GetRightNode()})
+        {
+            if (nullptr != pChildNode)
+            {
+                vStack.push_back({pChildNode, nLevel + 1});
+            }
+        }
+    }
+
+    std::vector<Node *> vNodes;
+
+    vNodes.reserve(ipBinaryTree->_nNodeCount);
+
+    Layout(ipBinaryTree->_pRootNode, nLevels, vNodes);
+
+    std::unordered_map<const Node *, int> mapPositions;
+
+    mapPositions.reserve(vNodes.size());
+
+    for (int nIdx = 0; nIdx < (int)(vNodes.size()); ++nIdx)
+    {
+        mapPositions[vNodes[nIdx]] = nIdx;
+    }
+
+    _vEntries.resize(vNodes.size());
+
+    for (int nIdx = 0; nIdx < (int)(vNodes.size()); ++nIdx)
+    {
+        Node *pLNode = vNodes[nIdx]->GetLeftNode();
+        Node *pRNode = vNodes[nIdx]->GetRightNode();
+
+        _vEntries[nIdx] = {vNodes[nIdx]->GetData(),
+                           {(nullptr != pLNode) ? mapPositions[pLNode] : -1,
+                            (nullptr != pRNode) ? mapPositions[pRNode] : -1}};
+    }
+}
+
+//-------------------------------------------------------------------
+bool VanEmdeBoasSnapshot::Search(int inData) const
+{
+    return (-1 != Find(inData));
+}
+
+//-------------------------------------------------------------------
+void VanEmdeBoasSnapshot::RetrieveDecendants(int inData,
+                                             std::vector<int> &ovData) const
+{
+    ovData.clear();
+
+    int nIdx = Find(inData);
+
+    if (-1 == nIdx)
+    {
+        return;
+    }
+
+    std::vector<int> vStack(1, nIdx);
+
+    while (!vStack.empty())
+    {
+        const Entry &objEntry = _vEntries[vStack.back()];
+
+        vStack.pop_back();
+
+        ovData.push_back(objEntry.nData);
+
+        for (int nChildIdx : {objEntry.anChildIdx[1], objEntry.anChildIdx[0]})
+        {
+            if (-1 != nChildIdx)
+            {
+                vStack.push_back(nChildIdx);
+            }
+        }
+    }
+}
+
+//-------------------------------------------------------------------
+void VanEmdeBoasSnapshot::PrintDecendants(int inData) const
+{
+    std::vector<int> vData;
+
+    RetrieveDecendants(inData, vData);
+
+    std::cout << "Decendants of " << inData << ": ";
+
+    for (auto nData : vData)
+    {
+        std::cout << nData << " ";
+    }
+
+    std::cout << std::endl;
+}
+
+//-------------------------------------------------------------------
+int VanEmdeBoasSnapshot::Size() const
+{
+    return (int)(_vEntries.size());
+}
+
+//===================================================================
+// Private Methods: Implementation
+//===================================================================
+
+//-------------------------------------------------------------------
+void VanEmdeBoasSnapshot::Layout(Node *ipNode,
+                                 int inLevels,
+                                 std::vector<Node *> &iovNodes)
+{
+    if (1 == inLevels)
+    {
+        iovNodes.push_back(ipNode);
+        return;
+    }
+
+    int nTopLevels = inLevels / 2;
+
+    Layout(ipNode, nTopLevels, iovNodes);
+
+    /**
+     * The roots of the bottom trees are the nodes right below the
+     * last level of the top tree, from left to right
+     */
+    std::vector<Node *> vRootNodes(1, ipNode);
+    std::vector<Node *> vNextRootNodes;
+
+    for (int nLevel = 0; nLevel < nTopLevels; ++nLevel)
+    {
+        vNextRootNodes.clear();
+
+        for (auto pNode : vRootNodes)
+        {
+            for (Node *pChildNode : {pNode->GetLeftNode(), pNode->GetRightNode()})
+            {
+                if (nullptr != pChildNode)
+                {
+                    vNextRootNodes.push_back(pChildNode);
+                }
+            }
+        }
+
+        std::swap(vRootNodes, vNextRootNodes);
+    }
+
+    for (auto pNode : vRootNodes)
+    {
+        Layout(pNode, inLevels - nTopLevels, iovNodes);
+    }
+}
+
+//-------------------------------------------------------------------
+int VanEmdeBoasSnapshot::Find(int inData) const
+{
+    if (_vEntries.empty())
+    {
+        return -1;
+    }
+
+    if (_bOrderedTree)
+    {
+        int nIdx(0);
+
+        while ((-1 != nIdx) && (_vEntries[nIdx].nData != inData))
+        {
+            nIdx = _vEntries[nIdx].anChildIdx[inData >= _vEntries[nIdx].nData];
+        }
+
+        return nIdx;
+    }
+
+    /**
+     * Depth-first, left before right, as BinaryTree searches
+     */
+    std::vector<int> vStack(1, 0);
+
+    while (!vStack.empty())
+    {
+        int nIdx = vStack.back();
+
+        vStack.pop_back();
+
+        if (_vEntries[nIdx].nData == inData)
+        {
+            return nIdx;
+        }
+
+        for (int nChildIdx : {_vEntries[nIdx].anChildIdx[1], _vEntries[nIdx].anChildIdx[0]})
+        {
+            if (-1 != nChildIdx)
+            {
+                vStack.push_back(nChildIdx);
+            }
+        }
+    }
+
+    return -1;
+}
@@ -9,10 +9,16 @@
 //-------------------------------------------------------------------
 
 // ---------------------------------------------- Local Headers
+#include "BPlusTree.h"
 #include "BinaryTree.h"
+#include "BinaryTreeCursor.h"
+#include "EytzingerSnapshot.h"
+#include "VanEmdeBoasSnapshot.h"
 
 // ---------------------------------------------- System Headers
 #include <iostream>
+#include <sstream>
+#include <thread>
 #include <vector>
 
 /**
@@ -37,6 +43,31 @@ BinaryTree *RetrieveInitialisedBinaryTree();
  */
 BinaryTree *RetrieveInitialisedBinarySearchTree();
 
+/**
+ * @brief Creates and initialises the binary tree from several threads
+ * @details Each thread inserts its share of the data with ConcurrentInsertNodeInBinaryTree(), so the level order of the data depends on the thread schedule.
+ * @return Pointer to created BinaryTree instance
+ * @note Delete the pointer returned by the method
+ */
+BinaryTree *RetrieveConcurrentlyInitialisedBinaryTree();
+
+/**
+ * @brief Creates and initialises the binary search tree from a nearly-sorted stream
+ * @details Each data is inserted with InsertNodeInBinarySearchTreeFromFinger(), starting from the previous insertion point.
+ * @param[in] ieMode Balancing mode of the binary search tree
+ * @return Pointer to created BinaryTree instance
+ * @note Delete the pointer returned by the method
+ */
+BinaryTree *RetrieveFingerInitialisedBinarySearchTree(BinaryTree::BalancingMode ieMode);
+
+/**
+ * @brief Creates and initialises the binary search tree in multiset mode
+ * @details Each data is inserted several times, duplicates are counted in the node already holding the data.
+ * @return Pointer to created BinaryTree instance
+ * @note Delete the pointer returned by the method
+ */
+BinaryTree *RetrieveInitialisedMultisetBinarySearchTree();
+
 /**
  * @brief Displays the list of all the operations of binary tree
  * @return Option number chosen by user w.r.t. the operation
@@ -75,6 +106,16 @@ int main()
         pBinaryTree1->PrintAncestor(30);
         pBinaryTree1->PrintDecendants(6);
 
+        VanEmdeBoasSnapshot objCompleteSnapshot(pBinaryTree1);
+        objCompleteSnapshot.PrintDecendants(6);
+
+        pBinaryTree1->EnableNodeIndex();
+        pBinaryTree1->PrintSibling(12);
+        pBinaryTree1->PrintCousins(12);
+        pBinaryTree1->DeleteBinaryTreeNode(3);
+        pBinaryTree1->LevelOrderTraversal();
+        pBinaryTree1->PrintAncestors(30);
+
         BinaryTree::RemoveBinaryTree(pBinaryTree1);
     }
 
@@ -97,9 +138,369 @@ int main()
         pBinaryTree2->PrintAncestor(15);
         pBinaryTree2->PrintDecendants(6);
 
+        VanEmdeBoasSnapshot objOrderedSnapshot(pBinaryTree2);
+        objOrderedSnapshot.PrintDecendants(6);
+
+        pBinaryTree2->DeleteBinaryTreeNode(16);
+        pBinaryTree2->DeleteBinaryTreeNode(8);
+        pBinaryTree2->LevelOrderTraversal();
+
+        pBinaryTree2->EnableBloomFilter(31);
+        std::cout << "Search 24: " << pBinaryTree2->SearchInBinaryTree(24) << std::endl;
+        std::cout << "Search 40: " << pBinaryTree2->SearchInBinaryTree(40) << std::endl;
+
+        std::vector<int> vSearchData = {1, 40, 17, 0, 31};
+        std::vector<bool> vFound;
+
+        pBinaryTree2->SearchInBinaryTree(vSearchData, vFound);
+
+        std::cout << "Batch search: ";
+
+        for (int nIdx = 0; nIdx < (int)(vSearchData.size()); ++nIdx)
+        {
+            std::cout << vSearchData[nIdx] << (vFound[nIdx] ? "(found) " : "(absent) ");
+        }
+
+        std::cout << std::endl;
+
+        std::cout << "Distinct data less than 20: " << pBinaryTree2->CountDistinctDataLessThan(20) << std::endl;
+
         BinaryTree::RemoveBinaryTree(pBinaryTree2);
     }
 
+    BinaryTree *pBinaryTree3 = RetrieveConcurrentlyInitialisedBinaryTree();
+
+    if (nullptr != pBinaryTree3)
+    {
+        pBinaryTree3->LevelOrderTraversal();
+        std::cout << "Height of binary tree: " << pBinaryTree3->HeightOfBinaryTree() << std::endl;
+
+        BinaryTree::RemoveBinaryTree(pBinaryTree3);
+    }
+
+    BinaryTree *pBinaryTree4 = RetrieveFingerInitialisedBinarySearchTree(BinaryTree::BALANCING_NONE);
+
+    if (nullptr != pBinaryTree4)
+    {
+        pBinaryTree4->InOrderTraversal();
+
+        BinaryTree::RemoveBinaryTree(pBinaryTree4);
+    }
+
+    pBinaryTree4 = RetrieveFingerInitialisedBinarySearchTree(BinaryTree::BALANCING_RED_BLACK);
+
+    if (nullptr != pBinaryTree4)
+    {
+        pBinaryTree4->InOrderTraversal();
+        std::cout << "Height of red-black binary tree: " << pBinaryTree4->HeightOfBinaryTree() << std::endl;
+
+        BinaryTree::RemoveBinaryTree(pBinaryTree4);
+    }
+
+    BinaryTree *pBinaryTree5 = RetrieveInitialisedMultisetBinarySearchTree();
+
+    if (nullptr != pBinaryTree5)
+    {
+        pBinaryTree5->InOrderTraversal();
+        pBinaryTree5->InOrderTraversal(true);
+        pBinaryTree5->LevelOrderTraversal();
+
+        EytzingerSnapshot objSnapshot(pBinaryTree5);
+
+        int nLowerBound(0);
+        int nUpperBound(0);
+
+        if (objSnapshot.LowerBound(4, nLowerBound) && objSnapshot.UpperBound(4, nUpperBound))
+        {
+            std::cout << "Snapshot of " << objSnapshot.Size() << " data, lower bound of 4: " << nLowerBound
+                      << ", upper bound of 4: " << nUpperBound << std::endl;
+        }
+
+        pBinaryTree5->DeleteBinaryTreeNode(5);
+        objSnapshot.Refresh(pBinaryTree5);
+
+        if (objSnapshot.UpperBound(4, nUpperBound))
+        {
+            std::cout << "Refreshed snapshot of " << objSnapshot.Size() << " data, upper bound of 4: "
+                      << nUpperBound << std::endl;
+        }
+
+        BinaryTree::RemoveBinaryTree(pBinaryTree5);
+    }
+
+    BinaryTree *pBinaryTree6 = BinaryTree::CreateBinaryTreeFromPostOrderAndInOrder({4, 5, 2, 6, 8, 7, 3, 1},
+                                                                                   {4, 2, 5, 1, 6, 3, 8, 7});
+
+    if (nullptr != pBinaryTree6)
+    {
+        pBinaryTree6->PreOrderTraversal();
+        pBinaryTree6->LevelOrderTraversal();
+
+        pBinaryTree6->EnableRadixIndex();
+        pBinaryTree6->DeleteBinaryTreeNode(8);
+        std::cout << "Search 7: " << pBinaryTree6->SearchInBinaryTree(7) << std::endl;
+        std::cout << "Search 8: " << pBinaryTree6->SearchInBinaryTree(8) << std::endl;
+
+        BinaryTree::RemoveBinaryTree(pBinaryTree6);
+    }
+
+    std::istringstream objSortedStream("1 2 3 4 5 6 7 8 9 10 11 12 13 14 15");
+
+    BinaryTree *pBinaryTree7 = BinaryTree::CreateBinarySearchTreeFromSortedStream(objSortedStream, 15);
+
+    if (nullptr != pBinaryTree7)
+    {
+        pBinaryTree7->LevelOrderTraversal();
+        std::cout << "Height of binary tree: " << pBinaryTree7->HeightOfBinaryTree() << std::endl;
+
+        BinaryTree::RemoveBinaryTree(pBinaryTree7);
+    }
+
+    BinaryTree *pBinaryTree8 = BinaryTree::CreateBinaryTree();
+
+    if (nullptr != pBinaryTree8)
+    {
+        pBinaryTree8->SetBalancingMode(BinaryTree::BALANCING_RED_BLACK);
+        pBinaryTree8->EnableSubtreeHeights();
+
+        for (int nData = 1; nData <= 15; ++nData)
+        {
+            pBinaryTree8->InsertNodeInBinarySearchTree(nData);
+        }
+
+        pBinaryTree8->LevelOrderTraversal();
+        std::cout << "Height of red-black tree: " << pBinaryTree8->HeightOfBinaryTree() << std::endl;
+
+        pBinaryTree8->DeleteBinaryTreeNode(4);
+        pBinaryTree8->DeleteBinaryTreeNode(8);
+        pBinaryTree8->LevelOrderTraversal();
+        std::cout << "Height of sub-binary tree of 12: " << pBinaryTree8->HeightOfNode(12) << std::endl;
+
+        BinaryTree::RemoveBinaryTree(pBinaryTree8);
+    }
+
+    BinaryTree *pBinaryTree9 = BinaryTree::CreateBinaryTree();
+
+    if (nullptr != pBinaryTree9)
+    {
+        pBinaryTree9->SetBalancingMode(BinaryTree::BALANCING_SPLAY);
+
+        for (int nData : {5000, 3000, 7000, 2000, 4000, 6000, 8000})
+        {
+            pBinaryTree9->InsertNodeInBinarySearchTree(nData);
+        }
+
+        std::cout << "Search 4000: " << pBinaryTree9->SearchInBinaryTree(4000) << std::endl;
+        pBinaryTree9->LevelOrderTraversal();
+
+        BinaryTree::RemoveBinaryTree(pBinaryTree9);
+    }
+
+    BinaryTree *pBinaryTree10 = BinaryTree::CreateBinaryTree();
+
+    if (nullptr != pBinaryTree10)
+    {
+        pBinaryTree10->SetBalancingMode(BinaryTree::BALANCING_SCAPEGOAT);
+
+        for (int nData = 1; nData <= 15; ++nData)
+        {
+            pBinaryTree10->InsertNodeInBinarySearchTree(nData);
+        }
+
+        pBinaryTree10->LevelOrderTraversal();
+        std::cout << "Height of scapegoat tree: " << pBinaryTree10->HeightOfBinaryTree() << std::endl;
+
+        BinaryTree::RemoveBinaryTree(pBinaryTree10);
+    }
+
+    BinaryTree *pBinaryTree11 = BinaryTree::CreateBinaryTree();
+    BinaryTree *pBinaryTree12 = BinaryTree::CreateBinaryTree();
+
+    if ((nullptr != pBinaryTree11) && (nullptr != pBinaryTree12))
+    {
+        pBinaryTree11->SetBalancingMode(BinaryTree::BALANCING_TREAP);
+        pBinaryTree12->SetBalancingMode(BinaryTree::BALANCING_TREAP);
+
+        for (int nData = 1; nData <= 15; ++nData)
+        {
+            pBinaryTree11->InsertNodeInBinarySearchTree(nData);
+            pBinaryTree12->InsertNodeInBinarySearchTree(3 * nData);
+        }
+
+        pBinaryTree11->Union(pBinaryTree12);
+        pBinaryTree11->InOrderTraversal();
+
+        BinaryTree *pBinaryTree13 = pBinaryTree11->Split(20);
+
+        pBinaryTree11->InOrderTraversal();
+        pBinaryTree13->InOrderTraversal();
+
+        pBinaryTree11->Join(pBinaryTree13);
+
+        BinaryTree *pBinaryTree14 = BinaryTree::CreateBinaryTree();
+
+        pBinaryTree14->SetBalancingMode(BinaryTree::BALANCING_TREAP);
+
+        for (int nData = 2; nData <= 45; nData += 2)
+        {
+            pBinaryTree14->InsertNodeInBinarySearchTree(nData);
+        }
+
+        pBinaryTree11->Difference(pBinaryTree14);
+        pBinaryTree11->InOrderTraversal();
+
+        pBinaryTree11->EnableOrderStatistics();
+
+        int nMedian(0);
+
+        if (pBinaryTree11->Select(pBinaryTree11->CountOfData() / 2, nMedian))
+        {
+            std::cout << "Median: " << nMedian << std::endl;
+        }
+
+        std::cout << "Rank of 21: " << pBinaryTree11->Rank(21) << std::endl;
+
+        std::vector<int> vRangeData;
+
+        pBinaryTree11->RangeQuery(5, 30, vRangeData);
+
+        std::cout << "Range 5 to 30:";
+
+        for (auto nData : vRangeData)
+        {
+            std::cout << " " << nData;
+        }
+
+        std::cout << std::endl;
+        std::cout << "Count in range 5 to 30: " << pBinaryTree11->RangeCount(5, 30) << std::endl;
+
+        pBinaryTree14 = BinaryTree::CreateBinaryTree();
+
+        pBinaryTree14->SetBalancingMode(BinaryTree::BALANCING_TREAP);
+
+        for (int nData = 100; nData <= 110; ++nData)
+        {
+            pBinaryTree14->InsertNodeInBinarySearchTree(nData);
+        }
+
+        pBinaryTree11->Intersection(pBinaryTree14);
+
+        std::cout << "Count of data after intersecting with disjoint data: " << pBinaryTree11->CountOfData() << std::endl;
+
+        BinaryTree::RemoveBinaryTree(pBinaryTree11);
+    }
+
+    BinaryTree *pBinaryTree15 = BinaryTree::CreateBinaryTree();
+
+    if (nullptr != pBinaryTree15)
+    {
+        pBinaryTree15->SetBalancingMode(BinaryTree::BALANCING_RED_BLACK);
+        pBinaryTree15->EnableRangeAggregates();
+
+        for (int nData = 1; nData <= 20; ++nData)
+        {
+            pBinaryTree15->InsertNodeInBinarySearchTree(nData);
+            pBinaryTree15->SetValue(nData, (nData * 7) % 11);
+        }
+
+        pBinaryTree15->DeleteBinaryTreeNode(9);
+
+        long long nSum(0);
+        int nMin(0);
+        int nMax(0);
+
+        if (pBinaryTree15->RangeAggregate(5, 15, nSum, nMin, nMax))
+        {
+            std::cout << "Values in range 5 to 15: sum " << nSum << ", min " << nMin << ", max " << nMax << std::endl;
+        }
+
+        int nFloor(0);
+        int nSuccessor(0);
+
+        if (pBinaryTree15->Floor(9, nFloor) && pBinaryTree15->Successor(9, nSuccessor))
+        {
+            std::cout << "Floor of 9: " << nFloor << ", successor of 9: " << nSuccessor << std::endl;
+        }
+
+        BinaryTreeCursor objCursor(pBinaryTree15);
+
+        std::cout << "From 17 upwards:";
+
+        for (bool bValid = objCursor.Seek(17); bValid; bValid = objCursor.Next())
+        {
+            std::cout << " " << objCursor.GetData();
+        }
+
+        std::cout << std::endl;
+
+        BinaryTree *pBinaryTree16 = pBinaryTree15->Split(12);
+
+        if (nullptr != pBinaryTree16)
+        {
+            pBinaryTree15->InOrderTraversal();
+            pBinaryTree16->InOrderTraversal();
+
+            pBinaryTree15->Join(pBinaryTree16);
+            pBinaryTree15->InOrderTraversal();
+        }
+
+        /**
+         * Splitting below the smallest data moves every node, splitting
+         * above the largest data moves none, either side is left empty
+         */
+        pBinaryTree16 = pBinaryTree15->Split(0);
+
+        if (nullptr != pBinaryTree16)
+        {
+            std::cout << "Count of data below 0: " << pBinaryTree15->CountOfData() << ", from 0 upwards: " << pBinaryTree16->CountOfData() << std::endl;
+
+            pBinaryTree15->Join(pBinaryTree16);
+        }
+
+        pBinaryTree16 = pBinaryTree15->Split(21);
+
+        if (nullptr != pBinaryTree16)
+        {
+            std::cout << "Count of data below 21: " << pBinaryTree15->CountOfData() << ", from 21 upwards: " << pBinaryTree16->CountOfData() << std::endl;
+
+            BinaryTree::RemoveBinaryTree(pBinaryTree16);
+        }
+
+        BinaryTree::RemoveBinaryTree(pBinaryTree15);
+    }
+
+    BPlusTree *pBPlusTree = BPlusTree::CreateBPlusTree();
+
+    if (nullptr != pBPlusTree)
+    {
+        for (int nData = 1; nData <= 40; ++nData)
+        {
+            pBPlusTree->InsertNodeInBinarySearchTree((nData * 17) % 41);
+        }
+
+        pBPlusTree->InsertNodeInBinarySearchTree(20);
+        pBPlusTree->DeleteBinaryTreeNode(7);
+
+        pBPlusTree->LevelOrderTraversal();
+        pBPlusTree->InOrderTraversal();
+        std::cout << "Height of B+ tree: " << pBPlusTree->HeightOfBinaryTree() << std::endl;
+        std::cout << "Search 24: " << pBPlusTree->SearchInBinaryTree(24) << std::endl;
+        std::cout << "Search 7: " << pBPlusTree->SearchInBinaryTree(7) << std::endl;
+
+        for (int nData = 1; nData <= 30; ++nData)
+        {
+            if (7 != nData)
+            {
+                pBPlusTree->DeleteBinaryTreeNode(nData);
+            }
+        }
+
+        pBPlusTree->LevelOrderTraversal();
+        std::cout << "Height of B+ tree: " << pBPlusTree->HeightOfBinaryTree() << std::endl;
+
+        BPlusTree::RemoveBPlusTree(pBPlusTree);
+    }
+
     return 0;
 }
 
@@ -143,6 +544,72 @@ BinaryTree *RetrieveInitialisedBinarySearchTree()
     return pBinaryTree;
 }
 
+//-------------------------------------------------------------------
+BinaryTree *RetrieveConcurrentlyInitialisedBinaryTree()
+{
+    BinaryTree *pBinaryTree = BinaryTree::CreateBinaryTree();
+
+    const int nThreads(4);
+    const int nValues(31);
+
+    std::vector<std::thread> vThreads;
+
+    for (int nThread = 0; nThread < nThreads; ++nThread)
+    {
+        vThreads.emplace_back([pBinaryTree, nThread]()
+                              {
+                                  for (int nValue = nThread + 1; nValue <= nValues; nValue += nThreads)
+                                  {
+                                      pBinaryTree->ConcurrentInsertNodeInBinaryTree(nValue);
+                                  } });
+    }
+
+    for (auto &objThread : vThreads)
+    {
+        objThread.join();
+    }
+
+    return pBinaryTree;
+}
+
+//-------------------------------------------------------------------
+BinaryTree *RetrieveFingerInitialisedBinarySearchTree(BinaryTree::BalancingMode ieMode)
+{
+    BinaryTree *pBinaryTree = BinaryTree::CreateBinaryTree();
+
+    pBinaryTree->SetBalancingMode(ieMode);
+
+    std::vector<int> vValues = {
+        1, 3, 2, 4, 5, 7, 6, 8, 10, 9, 11, 12, 14, 13, 15, 16,
+        18, 17, 19, 20, 22, 21, 23, 25, 24, 26, 27, 29, 28, 30, 31};
+
+    for (auto nValue : vValues)
+    {
+        pBinaryTree->InsertNodeInBinarySearchTreeFromFinger(nValue);
+    }
+
+    return pBinaryTree;
+}
+
+//-------------------------------------------------------------------
+BinaryTree *RetrieveInitialisedMultisetBinarySearchTree()
+{
+    BinaryTree *pBinaryTree = BinaryTree::CreateBinaryTree();
+
+    pBinaryTree->SetMultisetMode(true);
+
+    std::vector<int> vValues = {
+        4, 2, 6, 1, 3, 5, 7,
+        4, 4, 2, 6, 6, 6, 7};
+
+    for (auto nValue : vValues)
+    {
+        pBinaryTree->InsertNodeInBinarySearchTree(nValue);
+    }
+
+    return pBinaryTree;
+}
+
 //-------------------------------------------------------------------
 int RetrieveUserOperation()
 {
@@ -10,22 +10,26 @@
 // ---------------------------------------------- Project Headers
 #include "Node.h"
 
+// ---------------------------------------------- System Headers
+#include <atomic>
+
 //===================================================================
 // Public member functions
 //===================================================================
 
 //-------------------------------------------------------------------
 Node::Node(const int inData) : _nData(inData),
-                               _pLeftNode(nullptr),
-                               _pRightNode(nullptr)
+                               _nCount(1),
+                               _bRed(false),
+                               _apChildNodes{nullptr, nullptr}
 {
 }
 
 //-------------------------------------------------------------------
 Node::~Node()
 {
-    _pLeftNode = nullptr;
-    _pRightNode = nullptr;
+    _apChildNodes[0] = nullptr;
+    _apChildNodes[1] = nullptr;
 }
 
 //-------------------------------------------------------------------
@@ -34,26 +38,87 @@ int Node::GetData() const
     return _nData;
 }
 
+//-------------------------------------------------------------------
+int Node::GetCount() const
+{
+    return _nCount;
+}
+
+//-------------------------------------------------------------------
+void Node::SetCount(int inCount)
+{
+    _nCount = inCount;
+}
+
+//-------------------------------------------------------------------
+bool Node::IsRed() const
+{
+    return _bRed;
+}
+
+//-------------------------------------------------------------------
+void Node::SetRed(bool ibRed)
+{
+    _bRed = ibRed;
+}
+
 //-------------------------------------------------------------------
 Node *Node::GetLeftNode() const
 {
-    return _pLeftNode;
+    return _apChildNodes[0];
 }
 
 //-------------------------------------------------------------------
 Node *Node::GetRightNode() const
 {
-    return _pRightNode;
+    return _apChildNodes[1];
+}
+
+//-------------------------------------------------------------------
+Node *Node::GetChildNode(bool ibRight) const
+{
+    return _apChildNodes[ibRight];
 }
 
 //-------------------------------------------------------------------
 void Node::SetLeftNode(Node *ipLeftNode)
 {
-    _pLeftNode = ipLeftNode;
+    _apChildNodes[0] = ipLeftNode;
 }
 
 //-------------------------------------------------------------------
 void Node::SetRightNode(Node *ipRightNode)
 {
-    _pRightNode = ipRightNode;
+    _apChildNodes[1] = ipRightNode;
+}
+
+//-------------------------------------------------------------------
+void Node::SetChildNode(bool ibRight,
+                        Node *ipChildNode)
+{
+    _apChildNodes[ibRight] = ipChildNode;
+}
+
+//-------------------------------------------------------------------
+Node *Node::AcquireLeftNode() const
+{
+    return std::atomic_ref<Node *>(const_cast<Node *&>(_apChildNodes[0])).load(std::memory_order_acquire);
+}
+
+//-------------------------------------------------------------------
+Node *Node::AcquireRightNode() const
+{
+    return std::atomic_ref<Node *>(const_cast<Node *&>(_apChildNodes[1])).load(std::memory_order_acquire);
+}
+
+//-------------------------------------------------------------------
+void Node::PublishLeftNode(Node *ipLeftNode)
+{
+    std::atomic_ref<Node *>(_apChildNodes[0]).store(ipLeftNode, std::memory_order_release);
+}
+
+//-------------------------------------------------------------------
+void Node::PublishRightNode(Node *ipRightNode)
+{
+    std::atomic_ref<Node *>(_apChildNodes[1]).store(ipRightNode, std::memory_order_release);
 }
@@ -36,6 +36,32 @@ public:
      */
     int GetData() const;
 
+    /**
+     * @brief Retrieves the number of occurrences of the data element
+     * @return Number of occurrences, 1 unless duplicates are counted in the node
+     * @note It is a constant member function.
+     */
+    int GetCount() const;
+
+    /**
+     * @brief Sets the number of occurrences of the data element
+     * @param[in] inCount Number of occurrences
+     */
+    void SetCount(int inCount);
+
+    /**
+     * @brief Checks if the node is red in a red-black tree
+     * @return True if the node is red, false if it is black
+     * @note It is a constant member function.
+     */
+    bool IsRed() const;
+
+    /**
+     * @brief Sets the colour of the node in a red-black tree
+     * @param[in] ibRed True for red, false for black
+     */
+    void SetRed(bool ibRed);
+
     /**
      * @brief Retrieves the left node
      * @return Pointer to the left node
@@ -50,6 +76,15 @@ public:
      */
     Node *GetRightNode() const;
 
+    /**
+     * @brief Retrieves the left or the right node by index
+     * @param[in] ibRight False for the left node, true for the right node
+     * @return Pointer to the selected node
+     * @note It is a constant member function. The side is an array index, so a descent selecting the child
+     * from a comparison needs no branch.
+     */
+    Node *GetChildNode(bool ibRight) const;
+
     /**
      * @brief Sets the left node
      * @param[in] ipLeftNode Pointer to the left node
@@ -62,6 +97,40 @@ public:
      */
     void SetRightNode(Node *ipRightNode);
 
+    /**
+     * @brief Sets the left or the right node by index
+     * @param[in] ibRight False for the left node, true for the right node
+     * @param[in] ipChildNode Pointer to the node
+     */
+    void SetChildNode(bool ibRight,
+                      Node *ipChildNode);
+
+    /**
+     * @brief Retrieves the left node with acquire ordering
+     * @return Pointer to the left node
+     * @note Pairs with PublishLeftNode() so that a node linked by another thread is seen fully constructed.
+     */
+    Node *AcquireLeftNode() const;
+
+    /**
+     * @brief Retrieves the right node with acquire ordering
+     * @return Pointer to the right node
+     * @note Pairs with PublishRightNode() so that a node linked by another thread is seen fully constructed.
+     */
+    Node *AcquireRightNode() const;
+
+    /**
+     * @brief Sets the left node with release ordering
+     * @param[in] ipLeftNode Pointer to the fully constructed left node
+     */
+    void PublishLeftNode(Node *ipLeftNode);
+
+    /**
+     * @brief Sets the right node with release ordering
+     * @param[in] ipRightNode Pointer to the fully constructed right node
+     */
+    void PublishRightNode(Node *ipRightNode);
+
 private:
     /**
      * @brief Data element stored in the node
@@ -69,14 +138,20 @@ private:
     int _nData;
 
     /**
-     * @brief Pointer to the left node
+     * @brief Number of occurrences of the data element
+     * @note It shares its word with the colour, so the colour costs no memory.
+     */
+    int _nCount : 31;
+
+    /**
+     * @brief Colour of the node in a red-black tree, black unless set
      */
-    Node *_pLeftNode;
+    bool _bRed : 1;
 
     /**
-     * @brief Pointer to the right node
+     * @brief Pointers to the left node (index 0) and the right node (index 1)
      */
-    Node *_pRightNode;
+    Node *_apChildNodes[2];
 };
 
 #endif // _NODE_H_